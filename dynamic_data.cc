@@ -1,6 +1,8 @@
 #include "dynamic_data.hh"
 
-const Buffer<std::pair<s1_15, s1_15>, 513> DynamicData::sine = {{{
+#ifndef SYNTHESIZE_TABLES
+
+const Buffer<std::pair<s1_15, s1_15>, 513> DynamicData::sine_data = {{{
     { 0.01226844_s1_15, 0.01226844_s1_15 },
     { 0.02453688_s1_15, 0.01226844_s1_15 },
     { 0.03680532_s1_15, 0.01223792_s1_15 },
@@ -516,7 +518,7 @@ const Buffer<std::pair<s1_15, s1_15>, 513> DynamicData::sine = {{{
     { 0.01229896_s1_15, 0.01226844_s1_15 },
 }}};
 
-const Buffer<Buffer<f, 513>, 16> DynamicData::cheby = {{{
+const Buffer<Buffer<f, 513>, 16> DynamicData::cheby_data = {{{
     { -1.00000000_f, -0.99609375_f, -0.99218750_f, -0.98828125_f, -0.98437500_f, -0.98046875_f, -0.97656250_f, -0.97265625_f, -0.96875000_f, -0.96484375_f, -0.96093750_f, -0.95703125_f, -0.95312500_f, -0.94921875_f, -0.94531250_f, -0.94140625_f, -0.93750000_f, -0.93359375_f, -0.92968750_f, -0.92578125_f, -0.92187500_f, -0.91796875_f, -0.91406250_f, -0.91015625_f, -0.90625000_f, -0.90234375_f, -0.89843750_f, -0.89453125_f, -0.89062500_f, -0.88671875_f, -0.88281250_f, -0.87890625_f, -0.87500000_f, -0.87109375_f, -0.86718750_f, -0.86328125_f, -0.85937500_f, -0.85546875_f, -0.85156250_f, -0.84765625_f, -0.84375000_f, -0.83984375_f, -0.83593750_f, -0.83203125_f, -0.82812500_f, -0.82421875_f, -0.82031250_f, -0.81640625_f, -0.81250000_f, -0.80859375_f, -0.80468750_f, -0.80078125_f, -0.79687500_f, -0.79296875_f, -0.78906250_f, -0.78515625_f, -0.78125000_f, -0.77734375_f, -0.77343750_f, -0.76953125_f, -0.76562500_f, -0.76171875_f, -0.75781250_f, -0.75390625_f, -0.75000000_f, -0.74609375_f, -0.74218750_f, -0.73828125_f, -0.73437500_f, -0.73046875_f, -0.72656250_f, -0.72265625_f, -0.71875000_f, -0.71484375_f, -0.71093750_f, -0.70703125_f, -0.70312500_f, -0.69921875_f, -0.69531250_f, -0.69140625_f, -0.68750000_f, -0.68359375_f, -0.67968750_f, -0.67578125_f, -0.67187500_f, -0.66796875_f, -0.66406250_f, -0.66015625_f, -0.65625000_f, -0.65234375_f, -0.64843750_f, -0.64453125_f, -0.64062500_f, -0.63671875_f, -0.63281250_f, -0.62890625_f, -0.62500000_f, -0.62109375_f, -0.61718750_f, -0.61328125_f, -0.60937500_f, -0.60546875_f, -0.60156250_f, -0.59765625_f, -0.59375000_f, -0.58984375_f, -0.58593750_f, -0.58203125_f, -0.57812500_f, -0.57421875_f, -0.57031250_f, -0.56640625_f, -0.56250000_f, -0.55859375_f, -0.55468750_f, -0.55078125_f, -0.54687500_f, -0.54296875_f, -0.53906250_f, -0.53515625_f, -0.53125000_f, -0.52734375_f, -0.52343750_f, -0.51953125_f, -0.51562500_f, -0.51171875_f, -0.50781250_f, -0.50390625_f, -0.50000000_f, -0.49609375_f, -0.49218750_f, -0.48828125_f, -0.48437500_f, -0.48046875_f, -0.47656250_f, -0.47265625_f, -0.46875000_f, -0.46484375_f, -0.46093750_f, -0.45703125_f, -0.45312500_f, -0.44921875_f, -0.44531250_f, -0.44140625_f, -0.43750000_f, -0.43359375_f, -0.42968750_f, -0.42578125_f, -0.42187500_f, -0.41796875_f, -0.41406250_f, -0.41015625_f, -0.40625000_f, -0.40234375_f, -0.39843750_f, -0.39453125_f, -0.39062500_f, -0.38671875_f, -0.38281250_f, -0.37890625_f, -0.37500000_f, -0.37109375_f, -0.36718750_f, -0.36328125_f, -0.35937500_f, -0.35546875_f, -0.35156250_f, -0.34765625_f, -0.34375000_f, -0.33984375_f, -0.33593750_f, -0.33203125_f, -0.32812500_f, -0.32421875_f, -0.32031250_f, -0.31640625_f, -0.31250000_f, -0.30859375_f, -0.30468750_f, -0.30078125_f, -0.29687500_f, -0.29296875_f, -0.28906250_f, -0.28515625_f, -0.28125000_f, -0.27734375_f, -0.27343750_f, -0.26953125_f, -0.26562500_f, -0.26171875_f, -0.25781250_f, -0.25390625_f, -0.25000000_f, -0.24609375_f, -0.24218750_f, -0.23828125_f, -0.23437500_f, -0.23046875_f, -0.22656250_f, -0.22265625_f, -0.21875000_f, -0.21484375_f, -0.21093750_f, -0.20703125_f, -0.20312500_f, -0.19921875_f, -0.19531250_f, -0.19140625_f, -0.18750000_f, -0.18359375_f, -0.17968750_f, -0.17578125_f, -0.17187500_f, -0.16796875_f, -0.16406250_f, -0.16015625_f, -0.15625000_f, -0.15234375_f, -0.14843750_f, -0.14453125_f, -0.14062500_f, -0.13671875_f, -0.13281250_f, -0.12890625_f, -0.12500000_f, -0.12109375_f, -0.11718750_f, -0.11328125_f, -0.10937500_f, -0.10546875_f, -0.10156250_f, -0.09765625_f, -0.09375000_f, -0.08984375_f, -0.08593750_f, -0.08203125_f, -0.07812500_f, -0.07421875_f, -0.07031250_f, -0.06640625_f, -0.06250000_f, -0.05859375_f, -0.05468750_f, -0.05078125_f, -0.04687500_f, -0.04296875_f, -0.03906250_f, -0.03515625_f, -0.03125000_f, -0.02734375_f, -0.02343750_f, -0.01953125_f, -0.01562500_f, -0.01171875_f, -0.00781250_f, -0.00390625_f, 0.00000000_f, 0.00390625_f, 0.00781250_f, 0.01171875_f, 0.01562500_f, 0.01953125_f, 0.02343750_f, 0.02734375_f, 0.03125000_f, 0.03515625_f, 0.03906250_f, 0.04296875_f, 0.04687500_f, 0.05078125_f, 0.05468750_f, 0.05859375_f, 0.06250000_f, 0.06640625_f, 0.07031250_f, 0.07421875_f, 0.07812500_f, 0.08203125_f, 0.08593750_f, 0.08984375_f, 0.09375000_f, 0.09765625_f, 0.10156250_f, 0.10546875_f, 0.10937500_f, 0.11328125_f, 0.11718750_f, 0.12109375_f, 0.12500000_f, 0.12890625_f, 0.13281250_f, 0.13671875_f, 0.14062500_f, 0.14453125_f, 0.14843750_f, 0.15234375_f, 0.15625000_f, 0.16015625_f, 0.16406250_f, 0.16796875_f, 0.17187500_f, 0.17578125_f, 0.17968750_f, 0.18359375_f, 0.18750000_f, 0.19140625_f, 0.19531250_f, 0.19921875_f, 0.20312500_f, 0.20703125_f, 0.21093750_f, 0.21484375_f, 0.21875000_f, 0.22265625_f, 0.22656250_f, 0.23046875_f, 0.23437500_f, 0.23828125_f, 0.24218750_f, 0.24609375_f, 0.25000000_f, 0.25390625_f, 0.25781250_f, 0.26171875_f, 0.26562500_f, 0.26953125_f, 0.27343750_f, 0.27734375_f, 0.28125000_f, 0.28515625_f, 0.28906250_f, 0.29296875_f, 0.29687500_f, 0.30078125_f, 0.30468750_f, 0.30859375_f, 0.31250000_f, 0.31640625_f, 0.32031250_f, 0.32421875_f, 0.32812500_f, 0.33203125_f, 0.33593750_f, 0.33984375_f, 0.34375000_f, 0.34765625_f, 0.35156250_f, 0.35546875_f, 0.35937500_f, 0.36328125_f, 0.36718750_f, 0.37109375_f, 0.37500000_f, 0.37890625_f, 0.38281250_f, 0.38671875_f, 0.39062500_f, 0.39453125_f, 0.39843750_f, 0.40234375_f, 0.40625000_f, 0.41015625_f, 0.41406250_f, 0.41796875_f, 0.42187500_f, 0.42578125_f, 0.42968750_f, 0.43359375_f, 0.43750000_f, 0.44140625_f, 0.44531250_f, 0.44921875_f, 0.45312500_f, 0.45703125_f, 0.46093750_f, 0.46484375_f, 0.46875000_f, 0.47265625_f, 0.47656250_f, 0.48046875_f, 0.48437500_f, 0.48828125_f, 0.49218750_f, 0.49609375_f, 0.50000000_f, 0.50390625_f, 0.50781250_f, 0.51171875_f, 0.51562500_f, 0.51953125_f, 0.52343750_f, 0.52734375_f, 0.53125000_f, 0.53515625_f, 0.53906250_f, 0.54296875_f, 0.54687500_f, 0.55078125_f, 0.55468750_f, 0.55859375_f, 0.56250000_f, 0.56640625_f, 0.57031250_f, 0.57421875_f, 0.57812500_f, 0.58203125_f, 0.58593750_f, 0.58984375_f, 0.59375000_f, 0.59765625_f, 0.60156250_f, 0.60546875_f, 0.60937500_f, 0.61328125_f, 0.61718750_f, 0.62109375_f, 0.62500000_f, 0.62890625_f, 0.63281250_f, 0.63671875_f, 0.64062500_f, 0.64453125_f, 0.64843750_f, 0.65234375_f, 0.65625000_f, 0.66015625_f, 0.66406250_f, 0.66796875_f, 0.67187500_f, 0.67578125_f, 0.67968750_f, 0.68359375_f, 0.68750000_f, 0.69140625_f, 0.69531250_f, 0.69921875_f, 0.70312500_f, 0.70703125_f, 0.71093750_f, 0.71484375_f, 0.71875000_f, 0.72265625_f, 0.72656250_f, 0.73046875_f, 0.73437500_f, 0.73828125_f, 0.74218750_f, 0.74609375_f, 0.75000000_f, 0.75390625_f, 0.75781250_f, 0.76171875_f, 0.76562500_f, 0.76953125_f, 0.77343750_f, 0.77734375_f, 0.78125000_f, 0.78515625_f, 0.78906250_f, 0.79296875_f, 0.79687500_f, 0.80078125_f, 0.80468750_f, 0.80859375_f, 0.81250000_f, 0.81640625_f, 0.82031250_f, 0.82421875_f, 0.82812500_f, 0.83203125_f, 0.83593750_f, 0.83984375_f, 0.84375000_f, 0.84765625_f, 0.85156250_f, 0.85546875_f, 0.85937500_f, 0.86328125_f, 0.86718750_f, 0.87109375_f, 0.87500000_f, 0.87890625_f, 0.88281250_f, 0.88671875_f, 0.89062500_f, 0.89453125_f, 0.89843750_f, 0.90234375_f, 0.90625000_f, 0.91015625_f, 0.91406250_f, 0.91796875_f, 0.92187500_f, 0.92578125_f, 0.92968750_f, 0.93359375_f, 0.93750000_f, 0.94140625_f, 0.94531250_f, 0.94921875_f, 0.95312500_f, 0.95703125_f, 0.96093750_f, 0.96484375_f, 0.96875000_f, 0.97265625_f, 0.97656250_f, 0.98046875_f, 0.98437500_f, 0.98828125_f, 0.99218750_f, 0.99609375_f, 1.00000000_f },
     { 1.00000000_f, 0.98440552_f, 0.96887207_f, 0.95339966_f, 0.93798828_f, 0.92263794_f, 0.90734863_f, 0.89212036_f, 0.87695312_f, 0.86184692_f, 0.84680176_f, 0.83181763_f, 0.81689453_f, 0.80203247_f, 0.78723145_f, 0.77249146_f, 0.75781250_f, 0.74319458_f, 0.72863770_f, 0.71414185_f, 0.69970703_f, 0.68533325_f, 0.67102051_f, 0.65676880_f, 0.64257812_f, 0.62844849_f, 0.61437988_f, 0.60037231_f, 0.58642578_f, 0.57254028_f, 0.55871582_f, 0.54495239_f, 0.53125000_f, 0.51760864_f, 0.50402832_f, 0.49050903_f, 0.47705078_f, 0.46365356_f, 0.45031738_f, 0.43704224_f, 0.42382812_f, 0.41067505_f, 0.39758301_f, 0.38455200_f, 0.37158203_f, 0.35867310_f, 0.34582520_f, 0.33303833_f, 0.32031250_f, 0.30764771_f, 0.29504395_f, 0.28250122_f, 0.27001953_f, 0.25759888_f, 0.24523926_f, 0.23294067_f, 0.22070312_f, 0.20852661_f, 0.19641113_f, 0.18435669_f, 0.17236328_f, 0.16043091_f, 0.14855957_f, 0.13674927_f, 0.12500000_f, 0.11331177_f, 0.10168457_f, 0.09011841_f, 0.07861328_f, 0.06716919_f, 0.05578613_f, 0.04446411_f, 0.03320312_f, 0.02200317_f, 0.01086426_f, -0.00021362_f, -0.01123047_f, -0.02218628_f, -0.03308105_f, -0.04391479_f, -0.05468750_f, -0.06539917_f, -0.07604980_f, -0.08663940_f, -0.09716797_f, -0.10763550_f, -0.11804199_f, -0.12838745_f, -0.13867188_f, -0.14889526_f, -0.15905762_f, -0.16915894_f, -0.17919922_f, -0.18917847_f, -0.19909668_f, -0.20895386_f, -0.21875000_f, -0.22848511_f, -0.23815918_f, -0.24777222_f, -0.25732422_f, -0.26681519_f, -0.27624512_f, -0.28561401_f, -0.29492188_f, -0.30416870_f, -0.31335449_f, -0.32247925_f, -0.33154297_f, -0.34054565_f, -0.34948730_f, -0.35836792_f, -0.36718750_f, -0.37594604_f, -0.38464355_f, -0.39328003_f, -0.40185547_f, -0.41036987_f, -0.41882324_f, -0.42721558_f, -0.43554688_f, -0.44381714_f, -0.45202637_f, -0.46017456_f, -0.46826172_f, -0.47628784_f, -0.48425293_f, -0.49215698_f, -0.50000000_f, -0.50778198_f, -0.51550293_f, -0.52316284_f, -0.53076172_f, -0.53829956_f, -0.54577637_f, -0.55319214_f, -0.56054688_f, -0.56784058_f, -0.57507324_f, -0.58224487_f, -0.58935547_f, -0.59640503_f, -0.60339355_f, -0.61032104_f, -0.61718750_f, -0.62399292_f, -0.63073730_f, -0.63742065_f, -0.64404297_f, -0.65060425_f, -0.65710449_f, -0.66354370_f, -0.66992188_f, -0.67623901_f, -0.68249512_f, -0.68869019_f, -0.69482422_f, -0.70089722_f, -0.70690918_f, -0.71286011_f, -0.71875000_f, -0.72457886_f, -0.73034668_f, -0.73605347_f, -0.74169922_f, -0.74728394_f, -0.75280762_f, -0.75827026_f, -0.76367188_f, -0.76901245_f, -0.77429199_f, -0.77951050_f, -0.78466797_f, -0.78976440_f, -0.79479980_f, -0.79977417_f, -0.80468750_f, -0.80953979_f, -0.81433105_f, -0.81906128_f, -0.82373047_f, -0.82833862_f, -0.83288574_f, -0.83737183_f, -0.84179688_f, -0.84616089_f, -0.85046387_f, -0.85470581_f, -0.85888672_f, -0.86300659_f, -0.86706543_f, -0.87106323_f, -0.87500000_f, -0.87887573_f, -0.88269043_f, -0.88644409_f, -0.89013672_f, -0.89376831_f, -0.89733887_f, -0.90084839_f, -0.90429688_f, -0.90768433_f, -0.91101074_f, -0.91427612_f, -0.91748047_f, -0.92062378_f, -0.92370605_f, -0.92672729_f, -0.92968750_f, -0.93258667_f, -0.93542480_f, -0.93820190_f, -0.94091797_f, -0.94357300_f, -0.94616699_f, -0.94869995_f, -0.95117188_f, -0.95358276_f, -0.95593262_f, -0.95822144_f, -0.96044922_f, -0.96261597_f, -0.96472168_f, -0.96676636_f, -0.96875000_f, -0.97067261_f, -0.97253418_f, -0.97433472_f, -0.97607422_f, -0.97775269_f, -0.97937012_f, -0.98092651_f, -0.98242188_f, -0.98385620_f, -0.98522949_f, -0.98654175_f, -0.98779297_f, -0.98898315_f, -0.99011230_f, -0.99118042_f, -0.99218750_f, -0.99313354_f, -0.99401855_f, -0.99484253_f, -0.99560547_f, -0.99630737_f, -0.99694824_f, -0.99752808_f, -0.99804688_f, -0.99850464_f, -0.99890137_f, -0.99923706_f, -0.99951172_f, -0.99972534_f, -0.99987793_f, -0.99996948_f, -1.00000000_f, -0.99996948_f, -0.99987793_f, -0.99972534_f, -0.99951172_f, -0.99923706_f, -0.99890137_f, -0.99850464_f, -0.99804688_f, -0.99752808_f, -0.99694824_f, -0.99630737_f, -0.99560547_f, -0.99484253_f, -0.99401855_f, -0.99313354_f, -0.99218750_f, -0.99118042_f, -0.99011230_f, -0.98898315_f, -0.98779297_f, -0.98654175_f, -0.98522949_f, -0.98385620_f, -0.98242188_f, -0.98092651_f, -0.97937012_f, -0.97775269_f, -0.97607422_f, -0.97433472_f, -0.97253418_f, -0.97067261_f, -0.96875000_f, -0.96676636_f, -0.96472168_f, -0.96261597_f, -0.96044922_f, -0.95822144_f, -0.95593262_f, -0.95358276_f, -0.95117188_f, -0.94869995_f, -0.94616699_f, -0.94357300_f, -0.94091797_f, -0.93820190_f, -0.93542480_f, -0.93258667_f, -0.92968750_f, -0.92672729_f, -0.92370605_f, -0.92062378_f, -0.91748047_f, -0.91427612_f, -0.91101074_f, -0.90768433_f, -0.90429688_f, -0.90084839_f, -0.89733887_f, -0.89376831_f, -0.89013672_f, -0.88644409_f, -0.88269043_f, -0.87887573_f, -0.87500000_f, -0.87106323_f, -0.86706543_f, -0.86300659_f, -0.85888672_f, -0.85470581_f, -0.85046387_f, -0.84616089_f, -0.84179688_f, -0.83737183_f, -0.83288574_f, -0.82833862_f, -0.82373047_f, -0.81906128_f, -0.81433105_f, -0.80953979_f, -0.80468750_f, -0.79977417_f, -0.79479980_f, -0.78976440_f, -0.78466797_f, -0.77951050_f, -0.77429199_f, -0.76901245_f, -0.76367188_f, -0.75827026_f, -0.75280762_f, -0.74728394_f, -0.74169922_f, -0.73605347_f, -0.73034668_f, -0.72457886_f, -0.71875000_f, -0.71286011_f, -0.70690918_f, -0.70089722_f, -0.69482422_f, -0.68869019_f, -0.68249512_f, -0.67623901_f, -0.66992188_f, -0.66354370_f, -0.65710449_f, -0.65060425_f, -0.64404297_f, -0.63742065_f, -0.63073730_f, -0.62399292_f, -0.61718750_f, -0.61032104_f, -0.60339355_f, -0.59640503_f, -0.58935547_f, -0.58224487_f, -0.57507324_f, -0.56784058_f, -0.56054688_f, -0.55319214_f, -0.54577637_f, -0.53829956_f, -0.53076172_f, -0.52316284_f, -0.51550293_f, -0.50778198_f, -0.50000000_f, -0.49215698_f, -0.48425293_f, -0.47628784_f, -0.46826172_f, -0.46017456_f, -0.45202637_f, -0.44381714_f, -0.43554688_f, -0.42721558_f, -0.41882324_f, -0.41036987_f, -0.40185547_f, -0.39328003_f, -0.38464355_f, -0.37594604_f, -0.36718750_f, -0.35836792_f, -0.34948730_f, -0.34054565_f, -0.33154297_f, -0.32247925_f, -0.31335449_f, -0.30416870_f, -0.29492188_f, -0.28561401_f, -0.27624512_f, -0.26681519_f, -0.25732422_f, -0.24777222_f, -0.23815918_f, -0.22848511_f, -0.21875000_f, -0.20895386_f, -0.19909668_f, -0.18917847_f, -0.17919922_f, -0.16915894_f, -0.15905762_f, -0.14889526_f, -0.13867188_f, -0.12838745_f, -0.11804199_f, -0.10763550_f, -0.09716797_f, -0.08663940_f, -0.07604980_f, -0.06539917_f, -0.05468750_f, -0.04391479_f, -0.03308105_f, -0.02218628_f, -0.01123047_f, -0.00021362_f, 0.01086426_f, 0.02200317_f, 0.03320312_f, 0.04446411_f, 0.05578613_f, 0.06716919_f, 0.07861328_f, 0.09011841_f, 0.10168457_f, 0.11331177_f, 0.12500000_f, 0.13674927_f, 0.14855957_f, 0.16043091_f, 0.17236328_f, 0.18435669_f, 0.19641113_f, 0.20852661_f, 0.22070312_f, 0.23294067_f, 0.24523926_f, 0.25759888_f, 0.27001953_f, 0.28250122_f, 0.29504395_f, 0.30764771_f, 0.32031250_f, 0.33303833_f, 0.34582520_f, 0.35867310_f, 0.37158203_f, 0.38455200_f, 0.39758301_f, 0.41067505_f, 0.42382812_f, 0.43704224_f, 0.45031738_f, 0.46365356_f, 0.47705078_f, 0.49050903_f, 0.50402832_f, 0.51760864_f, 0.53125000_f, 0.54495239_f, 0.55871582_f, 0.57254028_f, 0.58642578_f, 0.60037231_f, 0.61437988_f, 0.62844849_f, 0.64257812_f, 0.65676880_f, 0.67102051_f, 0.68533325_f, 0.69970703_f, 0.71414185_f, 0.72863770_f, 0.74319458_f, 0.75781250_f, 0.77249146_f, 0.78723145_f, 0.80203247_f, 0.81689453_f, 0.83181763_f, 0.84680176_f, 0.86184692_f, 0.87695312_f, 0.89212036_f, 0.90734863_f, 0.92263794_f, 0.93798828_f, 0.95339966_f, 0.96887207_f, 0.98440552_f, 1.00000000_f },
     { -1.00000000_f, -0.96502662_f, -0.93041801_f, -0.89617276_f, -0.86228943_f, -0.82876658_f, -0.79560280_f, -0.76279664_f, -0.73034668_f, -0.69825149_f, -0.66650963_f, -0.63511968_f, -0.60408020_f, -0.57338977_f, -0.54304695_f, -0.51305032_f, -0.48339844_f, -0.45408988_f, -0.42512321_f, -0.39649701_f, -0.36820984_f, -0.34026027_f, -0.31264687_f, -0.28536820_f, -0.25842285_f, -0.23180938_f, -0.20552635_f, -0.17957234_f, -0.15394592_f, -0.12864566_f, -0.10367012_f, -0.07901788_f, -0.05468750_f, -0.03067756_f, -0.00698662_f, 0.01638675_f, 0.03944397_f, 0.06218648_f, 0.08461571_f, 0.10673308_f, 0.12854004_f, 0.15003800_f, 0.17122841_f, 0.19211268_f, 0.21269226_f, 0.23296857_f, 0.25294304_f, 0.27261710_f, 0.29199219_f, 0.31106973_f, 0.32985115_f, 0.34833789_f, 0.36653137_f, 0.38443303_f, 0.40204430_f, 0.41936660_f, 0.43640137_f, 0.45315003_f, 0.46961403_f, 0.48579478_f, 0.50169373_f, 0.51731229_f, 0.53265190_f, 0.54771399_f, 0.56250000_f, 0.57701135_f, 0.59124947_f, 0.60521579_f, 0.61891174_f, 0.63233876_f, 0.64549828_f, 0.65839171_f, 0.67102051_f, 0.68338609_f, 0.69548988_f, 0.70733333_f, 0.71891785_f, 0.73024487_f, 0.74131584_f, 0.75213218_f, 0.76269531_f, 0.77300668_f, 0.78306770_f, 0.79287982_f, 0.80244446_f, 0.81176305_f, 0.82083702_f, 0.82966781_f, 0.83825684_f, 0.84660554_f, 0.85471535_f, 0.86258769_f, 0.87022400_f, 0.87762570_f, 0.88479424_f, 0.89173102_f, 0.89843750_f, 0.90491509_f, 0.91116524_f, 0.91718936_f, 0.92298889_f, 0.92856526_f, 0.93391991_f, 0.93905425_f, 0.94396973_f, 0.94866776_f, 0.95314980_f, 0.95741725_f, 0.96147156_f, 0.96531415_f, 0.96894646_f, 0.97236991_f, 0.97558594_f, 0.97859597_f, 0.98140144_f, 0.98400378_f, 0.98640442_f, 0.98860478_f, 0.99060631_f, 0.99241042_f, 0.99401855_f, 0.99543214_f, 0.99665260_f, 0.99768138_f, 0.99851990_f, 0.99916959_f, 0.99963188_f, 0.99990821_f, 1.00000000_f, 0.99990869_f, 0.99963570_f, 0.99918246_f, 0.99855042_f, 0.99774098_f, 0.99675560_f, 0.99559569_f, 0.99426270_f, 0.99275804_f, 0.99108315_f, 0.98923945_f, 0.98722839_f, 0.98505139_f, 0.98270988_f, 0.98020530_f, 0.97753906_f, 0.97471261_f, 0.97172737_f, 0.96858478_f, 0.96528625_f, 0.96183324_f, 0.95822716_f, 0.95446944_f, 0.95056152_f, 0.94650483_f, 0.94230080_f, 0.93795085_f, 0.93345642_f, 0.92881894_f, 0.92403984_f, 0.91912055_f, 0.91406250_f, 0.90886712_f, 0.90353584_f, 0.89807010_f, 0.89247131_f, 0.88674092_f, 0.88088036_f, 0.87489104_f, 0.86877441_f, 0.86253190_f, 0.85616493_f, 0.84967494_f, 0.84306335_f, 0.83633161_f, 0.82948112_f, 0.82251334_f, 0.81542969_f, 0.80823159_f, 0.80092049_f, 0.79349780_f, 0.78596497_f, 0.77832341_f, 0.77057457_f, 0.76271987_f, 0.75476074_f, 0.74669862_f, 0.73853493_f, 0.73027110_f, 0.72190857_f, 0.71344876_f, 0.70489311_f, 0.69624305_f, 0.68750000_f, 0.67866540_f, 0.66974068_f, 0.66072726_f, 0.65162659_f, 0.64244008_f, 0.63316917_f, 0.62381530_f, 0.61437988_f, 0.60486436_f, 0.59527016_f, 0.58559871_f, 0.57585144_f, 0.56602979_f, 0.55613518_f, 0.54616904_f, 0.53613281_f, 0.52602792_f, 0.51585579_f, 0.50561786_f, 0.49531555_f, 0.48495030_f, 0.47452354_f, 0.46403670_f, 0.45349121_f, 0.44288850_f, 0.43223000_f, 0.42151713_f, 0.41075134_f, 0.39993405_f, 0.38906670_f, 0.37815070_f, 0.36718750_f, 0.35617852_f, 0.34512520_f, 0.33402896_f, 0.32289124_f, 0.31171346_f, 0.30049706_f, 0.28924346_f, 0.27795410_f, 0.26663041_f, 0.25527382_f, 0.24388576_f, 0.23246765_f, 0.22102094_f, 0.20954704_f, 0.19804740_f, 0.18652344_f, 0.17497659_f, 0.16340828_f, 0.15181994_f, 0.14021301_f, 0.12858891_f, 0.11694908_f, 0.10529494_f, 0.09362793_f, 0.08194947_f, 0.07026100_f, 0.05856395_f, 0.04685974_f, 0.03514981_f, 0.02343559_f, 0.01171851_f, -0.00000000_f, -0.01171851_f, -0.02343559_f, -0.03514981_f, -0.04685974_f, -0.05856395_f, -0.07026100_f, -0.08194947_f, -0.09362793_f, -0.10529494_f, -0.11694908_f, -0.12858891_f, -0.14021301_f, -0.15181994_f, -0.16340828_f, -0.17497659_f, -0.18652344_f, -0.19804740_f, -0.20954704_f, -0.22102094_f, -0.23246765_f, -0.24388576_f, -0.25527382_f, -0.26663041_f, -0.27795410_f, -0.28924346_f, -0.30049706_f, -0.31171346_f, -0.32289124_f, -0.33402896_f, -0.34512520_f, -0.35617852_f, -0.36718750_f, -0.37815070_f, -0.38906670_f, -0.39993405_f, -0.41075134_f, -0.42151713_f, -0.43223000_f, -0.44288850_f, -0.45349121_f, -0.46403670_f, -0.47452354_f, -0.48495030_f, -0.49531555_f, -0.50561786_f, -0.51585579_f, -0.52602792_f, -0.53613281_f, -0.54616904_f, -0.55613518_f, -0.56602979_f, -0.57585144_f, -0.58559871_f, -0.59527016_f, -0.60486436_f, -0.61437988_f, -0.62381530_f, -0.63316917_f, -0.64244008_f, -0.65162659_f, -0.66072726_f, -0.66974068_f, -0.67866540_f, -0.68750000_f, -0.69624305_f, -0.70489311_f, -0.71344876_f, -0.72190857_f, -0.73027110_f, -0.73853493_f, -0.74669862_f, -0.75476074_f, -0.76271987_f, -0.77057457_f, -0.77832341_f, -0.78596497_f, -0.79349780_f, -0.80092049_f, -0.80823159_f, -0.81542969_f, -0.82251334_f, -0.82948112_f, -0.83633161_f, -0.84306335_f, -0.84967494_f, -0.85616493_f, -0.86253190_f, -0.86877441_f, -0.87489104_f, -0.88088036_f, -0.88674092_f, -0.89247131_f, -0.89807010_f, -0.90353584_f, -0.90886712_f, -0.91406250_f, -0.91912055_f, -0.92403984_f, -0.92881894_f, -0.93345642_f, -0.93795085_f, -0.94230080_f, -0.94650483_f, -0.95056152_f, -0.95446944_f, -0.95822716_f, -0.96183324_f, -0.96528625_f, -0.96858478_f, -0.97172737_f, -0.97471261_f, -0.97753906_f, -0.98020530_f, -0.98270988_f, -0.98505139_f, -0.98722839_f, -0.98923945_f, -0.99108315_f, -0.99275804_f, -0.99426270_f, -0.99559569_f, -0.99675560_f, -0.99774098_f, -0.99855042_f, -0.99918246_f, -0.99963570_f, -0.99990869_f, -1.00000000_f, -0.99990821_f, -0.99963188_f, -0.99916959_f, -0.99851990_f, -0.99768138_f, -0.99665260_f, -0.99543214_f, -0.99401855_f, -0.99241042_f, -0.99060631_f, -0.98860478_f, -0.98640442_f, -0.98400378_f, -0.98140144_f, -0.97859597_f, -0.97558594_f, -0.97236991_f, -0.96894646_f, -0.96531415_f, -0.96147156_f, -0.95741725_f, -0.95314980_f, -0.94866776_f, -0.94396973_f, -0.93905425_f, -0.93391991_f, -0.92856526_f, -0.92298889_f, -0.91718936_f, -0.91116524_f, -0.90491509_f, -0.89843750_f, -0.89173102_f, -0.88479424_f, -0.87762570_f, -0.87022400_f, -0.86258769_f, -0.85471535_f, -0.84660554_f, -0.83825684_f, -0.82966781_f, -0.82083702_f, -0.81176305_f, -0.80244446_f, -0.79287982_f, -0.78306770_f, -0.77300668_f, -0.76269531_f, -0.75213218_f, -0.74131584_f, -0.73024487_f, -0.71891785_f, -0.70733333_f, -0.69548988_f, -0.68338609_f, -0.67102051_f, -0.65839171_f, -0.64549828_f, -0.63233876_f, -0.61891174_f, -0.60521579_f, -0.59124947_f, -0.57701135_f, -0.56250000_f, -0.54771399_f, -0.53265190_f, -0.51731229_f, -0.50169373_f, -0.48579478_f, -0.46961403_f, -0.45315003_f, -0.43640137_f, -0.41936660_f, -0.40204430_f, -0.38443303_f, -0.36653137_f, -0.34833789_f, -0.32985115_f, -0.31106973_f, -0.29199219_f, -0.27261710_f, -0.25294304_f, -0.23296857_f, -0.21269226_f, -0.19211268_f, -0.17122841_f, -0.15003800_f, -0.12854004_f, -0.10673308_f, -0.08461571_f, -0.06218648_f, -0.03944397_f, -0.01638675_f, 0.00698662_f, 0.03067756_f, 0.05468750_f, 0.07901788_f, 0.10367012_f, 0.12864566_f, 0.15394592_f, 0.17957234_f, 0.20552635_f, 0.23180938_f, 0.25842285_f, 0.28536820_f, 0.31264687_f, 0.34026027_f, 0.36820984_f, 0.39649701_f, 0.42512321_f, 0.45408988_f, 0.48339844_f, 0.51305032_f, 0.54304695_f, 0.57338977_f, 0.60408020_f, 0.63511968_f, 0.66650963_f, 0.69825149_f, 0.73034668_f, 0.76279664_f, 0.79560280_f, 0.82876658_f, 0.86228943_f, 0.89617276_f, 0.93041801_f, 0.96502662_f, 1.00000000_f },
@@ -535,7 +537,7 @@ const Buffer<Buffer<f, 513>, 16> DynamicData::cheby = {{{
     { 1.00000000_f, 0.15548956_f, -0.41733250_f, -0.77143449_f, -0.95249516_f, -0.99966550_f, -0.94626522_f, -0.82042503_f, -0.64566934_f, -0.44145453_f, -0.22365826_f, -0.00501329_f, 0.20447923_f, 0.39719531_f, 0.56755227_f, 0.71171737_f, 0.82733709_f, 0.91330320_f, 0.96953762_f, 0.99680245_f, 0.99653363_f, 0.97069389_f, 0.92164010_f, 0.85201252_f, 0.76463681_f, 0.66243690_f, 0.54836607_f, 0.42534560_f, 0.29621226_f, 0.16367811_f, 0.03029943_f, -0.10155487_f, -0.22971669_f, -0.35223642_f, -0.46739018_f, -0.57368541_f, -0.66986078_f, -0.75488180_f, -0.82793921_f, -0.88843679_f, -0.93598515_f, -0.97038853_f, -0.99163222_f, -0.99986905_f, -0.99540579_f, -0.97868794_f, -0.95028460_f, -0.91087347_f, -0.86122668_f, -0.80219489_f, -0.73469430_f, -0.65969115_f, -0.57819134_f, -0.49122417_f, -0.39983362_f, -0.30506551_f, -0.20795745_f, -0.10952914_f, -0.01077503_f, 0.08734673_f, 0.18391681_f, 0.27806473_f, 0.36897326_f, 0.45588243_f, 0.53809357_f, 0.61497241_f, 0.68595207_f, 0.75053376_f, 0.80828917_f, 0.85885900_f, 0.90195495_f, 0.93735760_f, 0.96491569_f, 0.98454499_f, 0.99622524_f, 0.99999857_f, 0.99596661_f, 0.98428744_f, 0.96517199_f, 0.93888092_f, 0.90572107_f, 0.86604130_f, 0.82022834_f, 0.76870334_f, 0.71191704_f, 0.65034682_f, 0.58449167_f, 0.51486814_f, 0.44200665_f, 0.36644769_f, 0.28873748_f, 0.20942450_f, 0.12905574_f, 0.04817426_f, -0.03268623_f, -0.11300236_f, -0.19226503_f, -0.26998216_f, -0.34568053_f, -0.41890979_f, -0.48924229_f, -0.55627698_f, -0.61963975_f, -0.67898571_f, -0.73400033_f, -0.78440046_f, -0.82993490_f, -0.87038493_f, -0.90556598_f, -0.93532658_f, -0.95954865_f, -0.97814757_f, -0.99107224_f, -0.99830377_f, -0.99985576_f, -0.99577296_f, -0.98613030_f, -0.97103173_f, -0.95061046_f, -0.92502505_f, -0.89446050_f, -0.85912532_f, -0.81925082_f, -0.77508801_f, -0.72690839_f, -0.67499971_f, -0.61966538_f, -0.56122249_f, -0.50000000_f, -0.43633682_f, -0.37057984_f, -0.30308187_f, -0.23420078_f, -0.16429597_f, -0.09372824_f, -0.02285701_f, 0.04796082_f, 0.11837333_f, 0.18803430_f, 0.25660533_f, 0.32375675_f, 0.38917011_f, 0.45253825_f, 0.51356769_f, 0.57197881_f, 0.62750745_f, 0.67990637_f, 0.72894496_f, 0.77441108_f, 0.81611139_f, 0.85387194_f, 0.88753885_f, 0.91697848_f, 0.94207811_f, 0.96274579_f, 0.97891068_f, 0.99052310_f, 0.99755454_f, 0.99999750_f, 0.99786484_f, 0.99119020_f, 0.98002696_f, 0.96444809_f, 0.94454575_f, 0.92043042_f, 0.89222986_f, 0.86008948_f, 0.82417029_f, 0.78464818_f, 0.74171460_f, 0.69557309_f, 0.64644057_f, 0.59454447_f, 0.54012281_f, 0.48342288_f, 0.42469972_f, 0.36421549_f, 0.30223775_f, 0.23903897_f, 0.17489460_f, 0.11008263_f, 0.04488170_f, -0.02042937_f, -0.08557320_f, -0.15027446_f, -0.21426210_f, -0.27726871_f, -0.33903340_f, -0.39930126_f, -0.45782518_f, -0.51436687_f, -0.56869733_f, -0.62059784_f, -0.66986072_f, -0.71629035_f, -0.75970352_f, -0.79993045_f, -0.83681470_f, -0.87021464_f, -0.90000308_f, -0.92606825_f, -0.94831383_f, -0.96665925_f, -0.98104012_f, -0.99140805_f, -0.99773103_f, -0.99999344_f, -0.99819589_f, -0.99235517_f, -0.98250401_f, -0.96869123_f, -0.95098096_f, -0.92945272_f, -0.90420055_f, -0.87533325_f, -0.84297335_f, -0.80725694_f, -0.76833266_f, -0.72636127_f, -0.68151546_f, -0.63397801_f, -0.58394217_f, -0.53161061_f, -0.47719386_f, -0.42091063_f, -0.36298591_f, -0.30365071_f, -0.24314104_f, -0.18169688_f, -0.11956120_f, -0.05697952_f, 0.00580204_f, 0.06853652_f, 0.13097800_f, 0.19288179_f, 0.25400603_f, 0.31411207_f, 0.37296584_f, 0.43033811_f, 0.48600596_f, 0.53975338_f, 0.59137189_f, 0.64066160_f, 0.68743175_f, 0.73150146_f, 0.77270055_f, 0.81087005_f, 0.84586263_f, 0.87754351_f, 0.90579063_f, 0.93049496_f, 0.95156187_f, 0.96890992_f, 0.98247254_f, 0.99219739_f, 0.99804747_f, 1.00000000_f, 0.99804747_f, 0.99219739_f, 0.98247254_f, 0.96890992_f, 0.95156187_f, 0.93049496_f, 0.90579063_f, 0.87754351_f, 0.84586263_f, 0.81087005_f, 0.77270055_f, 0.73150146_f, 0.68743175_f, 0.64066160_f, 0.59137189_f, 0.53975338_f, 0.48600596_f, 0.43033811_f, 0.37296584_f, 0.31411207_f, 0.25400603_f, 0.19288179_f, 0.13097800_f, 0.06853652_f, 0.00580204_f, -0.05697952_f, -0.11956120_f, -0.18169688_f, -0.24314104_f, -0.30365071_f, -0.36298591_f, -0.42091063_f, -0.47719386_f, -0.53161061_f, -0.58394217_f, -0.63397801_f, -0.68151546_f, -0.72636127_f, -0.76833266_f, -0.80725694_f, -0.84297335_f, -0.87533325_f, -0.90420055_f, -0.92945272_f, -0.95098096_f, -0.96869123_f, -0.98250401_f, -0.99235517_f, -0.99819589_f, -0.99999344_f, -0.99773103_f, -0.99140805_f, -0.98104012_f, -0.96665925_f, -0.94831383_f, -0.92606825_f, -0.90000308_f, -0.87021464_f, -0.83681470_f, -0.79993045_f, -0.75970352_f, -0.71629035_f, -0.66986072_f, -0.62059784_f, -0.56869733_f, -0.51436687_f, -0.45782518_f, -0.39930126_f, -0.33903340_f, -0.27726871_f, -0.21426210_f, -0.15027446_f, -0.08557320_f, -0.02042937_f, 0.04488170_f, 0.11008263_f, 0.17489460_f, 0.23903897_f, 0.30223775_f, 0.36421549_f, 0.42469972_f, 0.48342288_f, 0.54012281_f, 0.59454447_f, 0.64644057_f, 0.69557309_f, 0.74171460_f, 0.78464818_f, 0.82417029_f, 0.86008948_f, 0.89222986_f, 0.92043042_f, 0.94454575_f, 0.96444809_f, 0.98002696_f, 0.99119020_f, 0.99786484_f, 0.99999750_f, 0.99755454_f, 0.99052310_f, 0.97891068_f, 0.96274579_f, 0.94207811_f, 0.91697848_f, 0.88753885_f, 0.85387194_f, 0.81611139_f, 0.77441108_f, 0.72894496_f, 0.67990637_f, 0.62750745_f, 0.57197881_f, 0.51356769_f, 0.45253825_f, 0.38917011_f, 0.32375675_f, 0.25660533_f, 0.18803430_f, 0.11837333_f, 0.04796082_f, -0.02285701_f, -0.09372824_f, -0.16429597_f, -0.23420078_f, -0.30308187_f, -0.37057984_f, -0.43633682_f, -0.50000000_f, -0.56122249_f, -0.61966538_f, -0.67499971_f, -0.72690839_f, -0.77508801_f, -0.81925082_f, -0.85912532_f, -0.89446050_f, -0.92502505_f, -0.95061046_f, -0.97103173_f, -0.98613030_f, -0.99577296_f, -0.99985576_f, -0.99830377_f, -0.99107224_f, -0.97814757_f, -0.95954865_f, -0.93532658_f, -0.90556598_f, -0.87038493_f, -0.82993490_f, -0.78440046_f, -0.73400033_f, -0.67898571_f, -0.61963975_f, -0.55627698_f, -0.48924229_f, -0.41890979_f, -0.34568053_f, -0.26998216_f, -0.19226503_f, -0.11300236_f, -0.03268623_f, 0.04817426_f, 0.12905574_f, 0.20942450_f, 0.28873748_f, 0.36644769_f, 0.44200665_f, 0.51486814_f, 0.58449167_f, 0.65034682_f, 0.71191704_f, 0.76870334_f, 0.82022834_f, 0.86604130_f, 0.90572107_f, 0.93888092_f, 0.96517199_f, 0.98428744_f, 0.99596661_f, 0.99999857_f, 0.99622524_f, 0.98454499_f, 0.96491569_f, 0.93735760_f, 0.90195495_f, 0.85885900_f, 0.80828917_f, 0.75053376_f, 0.68595207_f, 0.61497241_f, 0.53809357_f, 0.45588243_f, 0.36897326_f, 0.27806473_f, 0.18391681_f, 0.08734673_f, -0.01077503_f, -0.10952914_f, -0.20795745_f, -0.30506551_f, -0.39983362_f, -0.49122417_f, -0.57819134_f, -0.65969115_f, -0.73469430_f, -0.80219489_f, -0.86122668_f, -0.91087347_f, -0.95028460_f, -0.97868794_f, -0.99540579_f, -0.99986905_f, -0.99163222_f, -0.97038853_f, -0.93598515_f, -0.88843679_f, -0.82793921_f, -0.75488180_f, -0.66986078_f, -0.57368541_f, -0.46739018_f, -0.35223642_f, -0.22971669_f, -0.10155487_f, 0.03029943_f, 0.16367811_f, 0.29621226_f, 0.42534560_f, 0.54836607_f, 0.66243690_f, 0.76463681_f, 0.85201252_f, 0.92164010_f, 0.97069389_f, 0.99653363_f, 0.99680245_f, 0.96953762_f, 0.91330320_f, 0.82733709_f, 0.71171737_f, 0.56755227_f, 0.39719531_f, 0.20447923_f, -0.00501329_f, -0.22365826_f, -0.44145453_f, -0.64566934_f, -0.82042503_f, -0.94626522_f, -0.99966550_f, -0.95249516_f, -0.77143449_f, -0.41733250_f, 0.15548956_f, 1.00000000_f },
 }}};
 
-const Buffer<std::pair<f, f>, 1025> DynamicData::fold = {{{
+const Buffer<std::pair<f, f>, 1025> DynamicData::fold_data = {{{
     { 0.98741576_f, 0.00000000_f },
     { 0.98741576_f, -0.00024764_f },
     { 0.98716812_f, -0.00025117_f },
@@ -1563,7 +1565,7 @@ const Buffer<std::pair<f, f>, 1025> DynamicData::fold = {{{
     { -0.98765990_f, -0.00024069_f },
 }}};
 
-const Buffer<f, 513> DynamicData::fold_max = {{{
+const Buffer<f, 513> DynamicData::fold_max_data = {{{
     92000.00000000_f,
     4.73996563_f,
     2.46225413_f,
@@ -2079,6 +2081,8 @@ const Buffer<f, 513> DynamicData::fold_max = {{{
     0.91999796_f,
 }}};
 
+#endif // SYNTHESIZE_TABLES
+
 const Buffer<Buffer<f, 9>, 9> DynamicData::triangles = {{{
     { 0.00000000_f, 0.25000000_f, 0.50000000_f, 0.58333331_f, 0.83333331_f, 1.00000000_f, 1.08333337_f, 1.25000000_f, 1.41666663_f },
     { 0.00000000_f, 0.16666667_f, 0.33333334_f, 0.50000000_f, 0.66666669_f, 0.83333331_f, 1.00000000_f, 1.16666663_f, 1.33333337_f },
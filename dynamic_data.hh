@@ -10,15 +10,63 @@ static constexpr int cheby_tables = 16;
 static constexpr int cheby_size = 512 + 1;
 static constexpr int fold_size = 1024 + 1;
 
-// Forward declare DynamicDataTables for the global pointer
-struct DynamicData;
+// Built with SYNTHESIZE_TABLES or FAST_TABLES the tables the engine reads
+// are not at fixed addresses, and it reaches them through TableRefs
+#if defined(SYNTHESIZE_TABLES) || defined(FAST_TABLES)
+#define REBIND_TABLES
+#endif
+
+#ifdef REBIND_TABLES
+// A table the engine reads per sample. It indexes through a pointer, so that
+// Tables::bind() can point it at the table's copy in memory.
+template <typename T> class TableRef {
+public:
+  constexpr TableRef(const T *table) : table_(table) {}
+
+  decltype(auto) operator[](int i) const { return (*table_)[i]; }
+  operator const T &() const { return *table_; }
+
+  void bind(const T *table) { table_ = table; }
+
+private:
+  const T *table_;
+};
+#endif
 
 struct DynamicData {
-  static const Buffer<std::pair<s1_15, s1_15>, sine_size> sine;
-  static const Buffer<Buffer<f, cheby_size>, cheby_tables> cheby;
-  static const Buffer<std::pair<f, f>, fold_size> fold;
-  static const Buffer<f, (fold_size - 1) / 2 + 1> fold_max;
+  using Sine = Buffer<std::pair<s1_15, s1_15>, sine_size>;
+  // Cheby and Fold are stored as float. The engine reads their entries as
+  // f in its per-sample loop, so half-precision storage would only pay off
+  // with a widening conversion on every one of those reads.
+  using Cheby = Buffer<Buffer<f, cheby_size>, cheby_tables>;
+  // Odd about its centre, but stored whole: a mirrored lower half would put
+  // a compare and a negation in every Fold lookup
+  using Fold = Buffer<std::pair<f, f>, fold_size>;
+  using FoldMax = Buffer<f, (fold_size - 1) / 2 + 1>;
+
+#ifndef SYNTHESIZE_TABLES
+  // The generated tables in the plugin image (dynamic_data.cc)
+  static const Sine sine_data;
+  static const Cheby cheby_data;
+  static const Fold fold_data;
+  static const FoldMax fold_max_data;
+#endif
+
+  // The tables the engine reads per sample. By default they are the
+  // generated tables themselves, read at their fixed addresses; otherwise
+  // see tables.hh.
+#ifdef REBIND_TABLES
+  static TableRef<Sine> sine;
+  static TableRef<Cheby> cheby;
+  static TableRef<Fold> fold;
+  static TableRef<FoldMax> fold_max;
+#else
+  static constexpr const Sine &sine = sine_data;
+  static constexpr const Cheby &cheby = cheby_data;
+  static constexpr const Fold &fold = fold_data;
+  static constexpr const FoldMax &fold_max = fold_max_data;
+#endif
   static const Buffer<Buffer<f, 9>, 9> triangles;
 };
 
-extern const Buffer<Buffer<s8_0, 9>, 8> triangles_12ths;
\ No newline at end of file
+extern const Buffer<Buffer<s8_0, 9>, 8> triangles_12ths;
@@ -11,15 +11,90 @@
 #define __INLINE        inline
 #define __STATIC_INLINE static inline
 
-/* Saturating adds – here we just fall back to plain +                */
-#define __QADD(a, b)    ((a) + (b))
-#define __QADD16(a, b)  ((a) + (b))
-#define __UQADD16(a, b) ((a) + (b))
-#define __QADD8(a, b)   ((a) + (b))
-#define __UQADD8(a, b)  ((a) + (b))
-
 #define __ASM __asm__
 
+/* Saturating adds and the dual MAC, with the CMSIS signatures. On the   */
+/* M7 these are the single-cycle DSP instructions; elsewhere (the host   */
+/* build) the lanes are added within one 32-bit word and clamped where   */
+/* they overflowed.                                                      */
+#if defined(__ARM_FEATURE_DSP)
+
+__STATIC_INLINE int32_t __QADD(int32_t a, int32_t b) {
+  int32_t r;
+  __ASM("qadd %0, %1, %2" : "=r"(r) : "r"(a), "r"(b));
+  return r;
+}
+
+__STATIC_INLINE uint32_t __QADD16(uint32_t a, uint32_t b) {
+  uint32_t r;
+  __ASM("qadd16 %0, %1, %2" : "=r"(r) : "r"(a), "r"(b));
+  return r;
+}
+
+__STATIC_INLINE uint32_t __UQADD16(uint32_t a, uint32_t b) {
+  uint32_t r;
+  __ASM("uqadd16 %0, %1, %2" : "=r"(r) : "r"(a), "r"(b));
+  return r;
+}
+
+__STATIC_INLINE uint32_t __QADD8(uint32_t a, uint32_t b) {
+  uint32_t r;
+  __ASM("qadd8 %0, %1, %2" : "=r"(r) : "r"(a), "r"(b));
+  return r;
+}
+
+__STATIC_INLINE uint32_t __UQADD8(uint32_t a, uint32_t b) {
+  uint32_t r;
+  __ASM("uqadd8 %0, %1, %2" : "=r"(r) : "r"(a), "r"(b));
+  return r;
+}
+
+#else
+
+__STATIC_INLINE int32_t __QADD(int32_t a, int32_t b) {
+  int64_t r = (int64_t)a + b;
+  return r > INT32_MAX ? INT32_MAX : r < INT32_MIN ? INT32_MIN : (int32_t)r;
+}
+
+/* Signed lanes: sum the low bits of each lane without carrying across,  */
+/* patch the sign bits back in, and where both inputs had the same sign  */
+/* but the sum does not, replace the lane by 0x7f.. or 0x80..            */
+__STATIC_INLINE uint32_t __qadd_lanes(uint32_t a, uint32_t b, uint32_t high,
+                                      int bits, uint32_t lane) {
+  uint32_t s = ((a & ~high) + (b & ~high)) ^ ((a ^ b) & high);
+  uint32_t ovf = ~(a ^ b) & (a ^ s) & high;
+  uint32_t sat = ~high + ((a & high) >> (bits - 1));
+  uint32_t mask = (ovf >> (bits - 1)) * lane;
+  return (s & ~mask) | (sat & mask);
+}
+
+/* Unsigned lanes: the carry out of each lane saturates it to all ones   */
+__STATIC_INLINE uint32_t __uqadd_lanes(uint32_t a, uint32_t b, uint32_t high,
+                                       int bits, uint32_t lane) {
+  uint32_t low = (a & ~high) + (b & ~high);
+  uint32_t s = low ^ ((a ^ b) & high);
+  uint32_t carry = ((a & b) | ((a ^ b) & low)) & high;
+  return s | ((carry >> (bits - 1)) * lane);
+}
+
+__STATIC_INLINE uint32_t __QADD16(uint32_t a, uint32_t b) {
+  return __qadd_lanes(a, b, 0x80008000u, 16, 0xffffu);
+}
+
+__STATIC_INLINE uint32_t __UQADD16(uint32_t a, uint32_t b) {
+  return __uqadd_lanes(a, b, 0x80008000u, 16, 0xffffu);
+}
+
+__STATIC_INLINE uint32_t __QADD8(uint32_t a, uint32_t b) {
+  return __qadd_lanes(a, b, 0x80808080u, 8, 0xffu);
+}
+
+__STATIC_INLINE uint32_t __UQADD8(uint32_t a, uint32_t b) {
+  return __uqadd_lanes(a, b, 0x80808080u, 8, 0xffu);
+}
+
+#endif
+
 /* Cortex-M4 DSP half-precision type                                   */
 using __fp16 = float;
 
@@ -0,0 +1,40 @@
+#pragma once
+
+// Bounded single-producer/single-consumer queue.
+//
+// One side only ever push()es and the other only ever pop()s; each owns one
+// index and reads the other's, so neither ever waits or takes a lock. push()
+// fails, rather than blocks, when the queue is full.
+
+#include <atomic>
+#include <stdint.h>
+
+template <typename T, int kCapacity> class SpscQueue {
+  static_assert((kCapacity & (kCapacity - 1)) == 0,
+                "capacity must be a power of two");
+
+public:
+  bool push(const T &value) {
+    const uint32_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_.load(std::memory_order_acquire) == kCapacity)
+      return false;
+    slots_[tail & (kCapacity - 1)] = value;
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T &value) {
+    const uint32_t head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire))
+      return false;
+    value = slots_[head & (kCapacity - 1)];
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+private:
+  T slots_[kCapacity] = {};
+  // Free-running; the difference is the number of queued values
+  std::atomic<uint32_t> head_{0};
+  std::atomic<uint32_t> tail_{0};
+};
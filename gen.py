@@ -119,15 +119,19 @@ def write_cc():
     with open("dynamic_data.cc", "w") as f:
         f.write('#include "dynamic_data.hh"\n\n')
 
+        # With SYNTHESIZE_TABLES the plugin computes these in initialise()
+        # (table_synth.cc) instead of carrying them in its image
+        f.write('#ifndef SYNTHESIZE_TABLES\n\n')
+
         # SINE
-        f.write(f'const Buffer<std::pair<s1_15, s1_15>, {sine_size}> DynamicData::sine = {{{{{{\n')
+        f.write(f'const Buffer<std::pair<s1_15, s1_15>, {sine_size}> DynamicData::sine_data = {{{{{{\n')
         for v, d in gen_sine():
             f.write(f'    {{ {v:.8f}_s1_15, {d:.8f}_s1_15 }},\n')
         f.write('}}};\n\n')
 
         # CHEBY
         cheby = gen_cheby()
-        f.write(f'const Buffer<Buffer<f, {cheby_size}>, {cheby_tables}> DynamicData::cheby = {{{{{{\n')
+        f.write(f'const Buffer<Buffer<f, {cheby_size}>, {cheby_tables}> DynamicData::cheby_data = {{{{{{\n')
         for row in cheby:
             f.write('    { ')
             f.write(', '.join(f'{x:.8f}_f' for x in row))
@@ -136,7 +140,7 @@ def write_cc():
 
         # FOLD
         fold = gen_fold()
-        f.write(f'const Buffer<std::pair<f, f>, {fold_size}> DynamicData::fold = {{{{{{\n')
+        f.write(f'const Buffer<std::pair<f, f>, {fold_size}> DynamicData::fold_data = {{{{{{\n')
         for v, d in fold:
             f.write(f'    {{ {v:.8f}_f, {d:.8f}_f }},\n')
         f.write('}}};\n\n')
@@ -144,11 +148,13 @@ def write_cc():
         # FOLD_MAX
         fold_max = gen_fold_max(fold)
         size = (fold_size - 1) // 2 + 1
-        f.write(f'const Buffer<f, {size}> DynamicData::fold_max = {{{{{{\n')
+        f.write(f'const Buffer<f, {size}> DynamicData::fold_max_data = {{{{{{\n')
         for x in fold_max:
             f.write(f'    {x:.8f}_f,\n')
         f.write('}}};\n\n')
 
+        f.write('#endif // SYNTHESIZE_TABLES\n\n')
+
         # TRIANGLES
         triangles = gen_triangles()
         f.write('const Buffer<Buffer<f, 9>, 9> DynamicData::triangles = {{{\n')
@@ -161,11 +167,15 @@ def write_cc():
     # --- MATH TABLE ---
     with open("math.cc", "w") as f:
         f.write('#include "math.hh"\n\n')
+        f.write('#ifdef SYNTHESIZE_TABLES\n')
+        f.write(f'uint32_t Math::exp2_table[{exp2_size}];\n')
+        f.write('#else\n')
         f.write(f'uint32_t Math::exp2_table[{exp2_size}] = {{\n') # Corrected: only one {
         for i in range(0, len(gen_exp2_table()), 8):
             row = gen_exp2_table()[i:i+8]
             f.write('    ' + ', '.join(map(str, row)) + ',\n')
-        f.write('};\n\n')
+        f.write('};\n')
+        f.write('#endif\n\n')
         # Empty constructor definition in case it is still needed by the build system.
         f.write('Math::Math() { }\n')
 
@@ -0,0 +1,204 @@
+// Microbenchmarks for the engine: times PolypticOscillator::Process on its
+// own and the plugin's full step() for every combination of Twist, Warp and
+// Mod mode, Stereo/Freeze split mode and oscillator count. The table
+// placement is fixed by the build and reported in the tables column.
+//
+// Output is CSV on stdout, one row per (kernel, configuration):
+//   kernel,tables,twist,warp,mod,stereo,freeze,num_osc,ns_per_sample,realtime_pct
+// where realtime_pct is the share of a 48 kHz per-sample budget used.
+
+#include "host_plugin.hh"
+#include "tables.hh"
+
+#include "./enosc/lib/easiglib/buffer.hh"
+#include "./enosc/lib/easiglib/numtypes.hh"
+#include "./enosc/src/parameters.hh"
+#include "./enosc/src/polyptic_oscillator.hh"
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+static const char *const kTwistNames[] = {"feedback", "pulsar", "crush"};
+static const char *const kWarpNames[] = {"fold", "cheby", "segment"};
+static const char *const kModNames[] = {"one", "two", "three"};
+static const char *const kSplitNames[] = {"alternate", "lo_hi", "lowest_rest"};
+#if defined(FAST_TABLES)
+static const char *const kTableName = "fast";
+#elif defined(SYNTHESIZE_TABLES)
+static const char *const kTableName = "synth";
+#else
+static const char *const kTableName = "plugin";
+#endif
+
+static constexpr double kBudgetNsPerSample = 1e9 / 48000.0;
+
+struct Config {
+  int twist, warp, mod, stereo, freeze, num_osc;
+};
+
+struct Options {
+  int samples = 8192;  // timed samples per configuration and repeat
+  int repeats = 3;     // best of N
+  int frames = 32;     // frames per step() call
+  bool process = true;
+  bool step = true;
+  int block = 0;   // "Engine block" specification for the step kernel
+};
+
+static double now_ns() {
+  return std::chrono::duration<double, std::nano>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// Engine parameters matching the plugin defaults with the mode-dependent
+// amounts at 50% so every kernel does real work.
+static void set_engine_parameters(Parameters &params, const Config &c) {
+  params.balance = 1.0_f;
+  params.root = 12.0_f;
+  params.pitch = 60.0_f;
+  params.spread = f(4.0f * 10.0f / 16.0f);
+  params.detune = 0.0_f;
+  params.fine_tune = 0.0_f;
+  params.new_note = 60.0_f;
+  params.modulation.mode = ModulationMode(c.mod);
+  params.modulation.value = 0.5_f;
+  params.scale.mode = ScaleMode(0);
+  params.scale.value = 0;
+  params.twist.mode = TwistMode(c.twist);
+  params.twist.value = 0.5_f;
+  params.warp.mode = WarpMode(c.warp);
+  params.warp.value = 0.5_f;
+  params.alt.crossfade_factor = 0.125_f;
+  params.alt.numOsc = c.num_osc;
+  params.alt.stereo_mode = SplitMode(c.stereo);
+  params.alt.freeze_mode = SplitMode(c.freeze);
+}
+
+static double bench_process(const Config &c, const Options &o) {
+  auto *params = new Parameters();
+  set_engine_parameters(*params, c);
+  auto *osc = new PolypticOscillator<kBlockSize>(*params);
+  Buffer<Frame, kBlockSize> blk;
+  uint8_t *itc = (uint8_t *)aligned_alloc(32, Tables::instanceBytes() + 32);
+  Tables::bind(Tables::instance(itc));
+
+  const int blocks = o.samples / kBlockSize;
+  for (int b = 0; b < blocks / 4; ++b) // warm up
+    osc->Process(blk);
+
+  double best = 1e30;
+  for (int r = 0; r < o.repeats; ++r) {
+    double start = now_ns();
+    for (int b = 0; b < blocks; ++b)
+      osc->Process(blk);
+    double elapsed = now_ns() - start;
+    if (elapsed < best)
+      best = elapsed;
+  }
+  Tables::unbind();
+  free(itc);
+  delete osc;
+  delete params;
+  return best / double(blocks * kBlockSize);
+}
+
+static double bench_step(const Config &c, const Options &o) {
+  const int32_t specifications[] = {o.block};
+  HostPlugin plugin(specifications);
+  plugin.set("Twist mode", int16_t(c.twist));
+  plugin.set("Twist", 50);
+  plugin.set("Warp mode", int16_t(c.warp));
+  plugin.set("Warp", 50);
+  plugin.set("Mod mode", int16_t(c.mod));
+  plugin.set("Cross FM", 50);
+  plugin.set("Stereo mode", int16_t(c.stereo));
+  plugin.set("Freeze mode", int16_t(c.freeze));
+  plugin.set("Num Osc", int16_t(c.num_osc));
+
+  std::vector<float> busses(HostPlugin::kNumBusses * o.frames, 0.0f);
+  const int steps = o.samples / o.frames;
+  for (int s = 0; s < steps / 4; ++s)
+    plugin.step(busses.data(), o.frames);
+
+  double best = 1e30;
+  for (int r = 0; r < o.repeats; ++r) {
+    double start = now_ns();
+    for (int s = 0; s < steps; ++s)
+      plugin.step(busses.data(), o.frames);
+    double elapsed = now_ns() - start;
+    if (elapsed < best)
+      best = elapsed;
+  }
+  return best / double(steps * o.frames);
+}
+
+static void print_row(const char *kernel, const Config &c, double ns) {
+  printf("%s,%s,%s,%s,%s,%s,%s,%d,%.2f,%.3f\n", kernel, kTableName,
+         kTwistNames[c.twist],
+         kWarpNames[c.warp], kModNames[c.mod], kSplitNames[c.stereo],
+         kSplitNames[c.freeze], c.num_osc, ns, 100.0 * ns / kBudgetNsPerSample);
+  fflush(stdout);
+}
+
+static void usage() {
+  fprintf(stderr,
+          "usage: nt_enosc_bench [options]\n"
+          "  -s SAMPLES  timed samples per configuration (default 8192)\n"
+          "  -r REPEATS  repeats, best is reported (default 3)\n"
+          "  -f FRAMES   frames per step() call (default 32)\n"
+          "  -k KERNEL   only 'process' or 'step'\n"
+          "  -b BLOCK    engine block for 'step' (0-3: 8 to 64 frames, default 0)\n");
+}
+
+int main(int argc, char **argv) {
+  Options o;
+  for (int i = 1; i < argc; ++i) {
+    bool has_value = i + 1 < argc;
+    if (!strcmp(argv[i], "-s") && has_value) {
+      o.samples = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-r") && has_value) {
+      o.repeats = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-f") && has_value) {
+      o.frames = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-k") && has_value) {
+      const char *k = argv[++i];
+      o.process = !strcmp(k, "process");
+      o.step = !strcmp(k, "step");
+    } else if (!strcmp(argv[i], "-b") && has_value) {
+      o.block = atoi(argv[++i]);
+    } else {
+      usage();
+      return 1;
+    }
+  }
+  if (o.samples < 64 || o.repeats < 1 || o.frames < 4 || o.frames % 4 != 0 ||
+      o.block < 0 || o.block > 3 ||
+      uint32_t(o.frames) > NT_globals.maxFramesPerStep) {
+    usage();
+    return 1;
+  }
+
+  // Loads the plugin, whose initialise() computes the tables with
+  // SYNTH_TABLES=1, before the process kernel reads them
+  HostPlugin::load();
+
+  printf("kernel,tables,twist,warp,mod,stereo,freeze,num_osc,ns_per_sample,"
+         "realtime_pct\n");
+  Config c;
+  for (c.twist = 0; c.twist < 3; ++c.twist)
+    for (c.warp = 0; c.warp < 3; ++c.warp)
+      for (c.mod = 0; c.mod < 3; ++c.mod)
+        for (c.stereo = 0; c.stereo < 3; ++c.stereo)
+          for (c.freeze = 0; c.freeze < 3; ++c.freeze)
+            for (c.num_osc = 1; c.num_osc <= 16; ++c.num_osc) {
+              if (o.process)
+                print_row("process", c, bench_process(c, o));
+              if (o.step)
+                print_row("step", c, bench_step(c, o));
+            }
+  return 0;
+}
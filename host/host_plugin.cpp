@@ -0,0 +1,114 @@
+#include "host_plugin.hh"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint8_t *host_alloc(uint32_t bytes) {
+  // The NT hands out 32-byte aligned blocks; mirror that so alignment bugs
+  // show up on the host too.
+  size_t size = (size_t(bytes) + 31) & ~size_t(31);
+  void *p = aligned_alloc(32, size ? size : 32);
+  if (p == nullptr) {
+    fprintf(stderr, "out of memory (%u bytes)\n", bytes);
+    abort();
+  }
+  memset(p, 0, size ? size : 32);
+  return (uint8_t *)p;
+}
+
+const _NT_factory *HostPlugin::load() {
+  static const _NT_factory *factory = nullptr;
+  if (factory != nullptr)
+    return factory;
+
+  if (pluginEntry(kNT_selector_numFactories, 0) < 1) {
+    fprintf(stderr, "plugin exposes no factories\n");
+    abort();
+  }
+  factory = (const _NT_factory *)pluginEntry(kNT_selector_factoryInfo, 0);
+
+  _NT_staticRequirements static_req = {};
+  if (factory->calculateStaticRequirements)
+    factory->calculateStaticRequirements(static_req);
+  _NT_staticMemoryPtrs static_ptrs = {};
+  static_ptrs.dram = host_alloc(static_req.dram);
+  if (factory->initialise)
+    factory->initialise(static_ptrs, static_req);
+  return factory;
+}
+
+HostPlugin::HostPlugin(const int32_t *specifications)
+    : factory_(load()), alg_(nullptr), req_() {
+  memset(specifications_, 0, sizeof(specifications_));
+  for (uint32_t i = 0; i < factory_->numSpecifications && i < kMaxSpecifications; ++i)
+    specifications_[i] = specifications ? specifications[i]
+                                        : factory_->specifications[i].def;
+
+  factory_->calculateRequirements(req_, specifications_);
+  if (req_.numParameters > kMaxParams) {
+    fprintf(stderr, "plugin has %u parameters, host supports %d\n",
+            req_.numParameters, kMaxParams);
+    abort();
+  }
+
+  sram_ = host_alloc(req_.sram);
+  dram_ = host_alloc(req_.dram);
+  dtc_ = host_alloc(req_.dtc);
+  itc_ = host_alloc(req_.itc);
+  _NT_algorithmMemoryPtrs ptrs = {};
+  ptrs.sram = sram_;
+  ptrs.dram = dram_;
+  ptrs.dtc = dtc_;
+  ptrs.itc = itc_;
+  alg_ = factory_->construct(ptrs, req_, specifications_);
+
+  memset(v_, 0, sizeof(v_));
+  alg_->v = v_;
+  alg_->vIncludingCommon = v_;
+  for (int p = 0; p < numParameters(); ++p)
+    set(p, alg_->parameters[p].def);
+}
+
+HostPlugin::~HostPlugin() {
+  free(sram_);
+  free(dram_);
+  free(dtc_);
+  free(itc_);
+}
+
+int HostPlugin::find(const char *name) const {
+  for (int p = 0; p < numParameters(); ++p) {
+    if (strcasecmp(alg_->parameters[p].name, name) == 0)
+      return p;
+  }
+  return -1;
+}
+
+void HostPlugin::set(int p, int16_t value) {
+  const _NT_parameter &param = alg_->parameters[p];
+  if (value < param.min)
+    value = param.min;
+  if (value > param.max)
+    value = param.max;
+  v_[p] = value;
+  if (factory_->parameterChanged)
+    factory_->parameterChanged(alg_, p);
+}
+
+bool HostPlugin::set(const char *name, int16_t value) {
+  int p = find(name);
+  if (p < 0)
+    return false;
+  set(p, value);
+  return true;
+}
+
+void HostPlugin::step(float *busFrames, int numFrames) {
+  factory_->step(alg_, busFrames, numFrames / 4);
+}
+
+void HostPlugin::print_requirements(const _NT_algorithmRequirements &req) {
+  printf("sram %u bytes, dram %u bytes, dtc %u bytes, itc %u bytes\n",
+         req.sram, req.dram, req.dtc, req.itc);
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+// Drives the plugin through its factory the same way the NT firmware does:
+// static requirements/initialise once, then calculateRequirements/construct,
+// parameterChanged() for every parameter, and step() on a bus buffer.
+
+#include <distingnt/api.h>
+#include <stdint.h>
+
+extern "C" uintptr_t pluginEntry(_NT_selector selector, uint32_t index);
+
+class HostPlugin {
+public:
+  static constexpr int kNumBusses = 28;
+  static constexpr int kMaxParams = 64;
+  static constexpr int kMaxSpecifications = 8;
+
+  // specifications may be null, in which case the factory defaults are used
+  explicit HostPlugin(const int32_t *specifications = nullptr);
+  ~HostPlugin();
+
+  const _NT_factory *factory() const { return factory_; }
+  _NT_algorithm *algorithm() const { return alg_; }
+  const _NT_algorithmRequirements &requirements() const { return req_; }
+  int numParameters() const { return int(req_.numParameters); }
+
+  // Returns the parameter index for a name, or -1
+  int find(const char *name) const;
+  int16_t get(int p) const { return v_[p]; }
+  void set(int p, int16_t value);
+  bool set(const char *name, int16_t value);
+
+  // Bus index (0-based) currently selected by an input/output parameter
+  int bus(int p) const { return v_[p] - 1; }
+
+  // Calls step() over numFrames frames of a kNumBusses * numFrames buffer
+  void step(float *busFrames, int numFrames);
+
+  static const _NT_factory *load();
+  static void print_requirements(const _NT_algorithmRequirements &req);
+
+private:
+  const _NT_factory *factory_;
+  _NT_algorithm *alg_;
+  _NT_algorithmRequirements req_;
+  int32_t specifications_[kMaxSpecifications];
+  int16_t v_[kMaxParams];
+  uint8_t *sram_;
+  uint8_t *dram_;
+  uint8_t *dtc_;
+  uint8_t *itc_;
+};
@@ -0,0 +1,122 @@
+// Checks the portable versions of the CMSIS saturating-add intrinsics in
+// enosc_plugin_stubs.h (the ones the host build uses) against plain
+// lane-by-lane reference arithmetic. Every intrinsic gets each pair of
+// lane-boundary values in every lane, then a run of random pairs. Prints one
+// line per intrinsic and exits non-zero if any result differs.
+
+#include <initializer_list>
+#include <stdint.h>
+#include <stdio.h>
+
+// Saturating add of the `bits`-wide lanes of a and b
+static uint32_t ref_lanes(uint32_t a, uint32_t b, int bits, bool is_signed) {
+  const uint32_t mask = bits == 32 ? 0xffffffffu : (1u << bits) - 1;
+  uint32_t out = 0;
+  for (int shift = 0; shift < 32; shift += bits) {
+    int64_t x = (a >> shift) & mask;
+    int64_t y = (b >> shift) & mask;
+    int64_t lo = 0, hi = int64_t(mask);
+    if (is_signed) {
+      const int64_t half = int64_t(1) << (bits - 1);
+      x = x >= half ? x - 2 * half : x;
+      y = y >= half ? y - 2 * half : y;
+      lo = -half;
+      hi = half - 1;
+    }
+    int64_t s = x + y;
+    s = s < lo ? lo : s > hi ? hi : s;
+    out |= (uint32_t(s) & mask) << shift;
+  }
+  return out;
+}
+
+// xorshift32, so that runs are repeatable
+static uint32_t next_random(uint32_t &state) {
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+struct Check {
+  const char *name;
+  int count = 0;
+  int mismatches = 0;
+
+  explicit Check(const char *n) : name(n) {}
+
+  void add(uint32_t got, uint32_t want, uint32_t a, uint32_t b) {
+    ++count;
+    if (got != want && mismatches++ == 0)
+      printf("  %s(0x%08x, 0x%08x) = 0x%08x, expected 0x%08x\n", name, a, b,
+             got, want);
+  }
+
+  bool report() const {
+    printf("%-8s %9d cases  %4d differ\n", name, count, mismatches);
+    return mismatches == 0;
+  }
+};
+
+// Lane values around zero and both saturation points
+static const uint32_t kEdges8[] = {0x00, 0x01, 0x7e, 0x7f, 0x80,
+                                   0x81, 0xfe, 0xff};
+static const uint32_t kEdges16[] = {0x0000, 0x0001, 0x7ffe, 0x7fff, 0x8000,
+                                    0x8001, 0xfffe, 0xffff};
+
+// Calls fn(a, b) for every pair of edge values placed in every lane, the
+// other lanes held at a second pair of edge values
+template <int kBits, typename F> static void edges(F fn) {
+  const uint32_t *values = kBits == 8 ? kEdges8 : kEdges16;
+  const int n = 8;
+  for (int shift = 0; shift < 32; shift += kBits)
+    for (int i = 0; i < n; ++i)
+      for (int j = 0; j < n; ++j)
+        for (int k = 0; k < n; ++k) {
+          uint32_t a = 0, b = 0;
+          for (int s = 0; s < 32; s += kBits) {
+            a |= (s == shift ? values[i] : values[k]) << s;
+            b |= (s == shift ? values[j] : values[n - 1 - k]) << s;
+          }
+          fn(a, b);
+        }
+}
+
+int main() {
+  const int kRandomPairs = 1000000;
+  bool ok = true;
+
+  Check qadd("QADD");
+  const int32_t edges32[] = {0,         1,         -1,
+                             2,         INT32_MAX, INT32_MAX - 1,
+                             INT32_MIN, INT32_MIN + 1};
+  for (int32_t a : edges32)
+    for (int32_t b : edges32)
+      qadd.add(uint32_t(__QADD(a, b)), ref_lanes(a, b, 32, true), a, b);
+
+  Check qadd16("QADD16"), uqadd16("UQADD16"), qadd8("QADD8"), uqadd8("UQADD8");
+  edges<16>([&](uint32_t a, uint32_t b) {
+    qadd16.add(__QADD16(a, b), ref_lanes(a, b, 16, true), a, b);
+    uqadd16.add(__UQADD16(a, b), ref_lanes(a, b, 16, false), a, b);
+  });
+  edges<8>([&](uint32_t a, uint32_t b) {
+    qadd8.add(__QADD8(a, b), ref_lanes(a, b, 8, true), a, b);
+    uqadd8.add(__UQADD8(a, b), ref_lanes(a, b, 8, false), a, b);
+  });
+
+  uint32_t state = 0x2545f491u;
+  for (int i = 0; i < kRandomPairs; ++i) {
+    const uint32_t a = next_random(state);
+    const uint32_t b = next_random(state);
+    qadd.add(uint32_t(__QADD(int32_t(a), int32_t(b))),
+             ref_lanes(a, b, 32, true), a, b);
+    qadd16.add(__QADD16(a, b), ref_lanes(a, b, 16, true), a, b);
+    uqadd16.add(__UQADD16(a, b), ref_lanes(a, b, 16, false), a, b);
+    qadd8.add(__QADD8(a, b), ref_lanes(a, b, 8, true), a, b);
+    uqadd8.add(__UQADD8(a, b), ref_lanes(a, b, 8, false), a, b);
+  }
+
+  for (const Check *c : {&qadd, &qadd16, &uqadd16, &qadd8, &uqadd8})
+    ok &= c->report();
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,35 @@
+// Host stand-in for the parts of the Disting NT firmware API that the plugin
+// links against. Only what the plugin actually references lives here; the
+// types themselves still come from distingnt/api.h.
+
+#include <distingnt/api.h>
+#include <distingnt/serialisation.h>
+#include <stdio.h>
+
+static float host_work_buffer[4096];
+
+const _NT_globals NT_globals = {
+    .sampleRate = 48000,
+    .maxFramesPerStep = 512,
+    .workBuffer = host_work_buffer,
+    .workBufferSizeBytes = sizeof(host_work_buffer),
+};
+
+// There is no screen on the host; text is printed so draw() output can be
+// inspected from the tools.
+void NT_drawText(int x, int y, const char *str, int colour,
+                 _NT_textAlignment align, _NT_textSize size) {
+  printf("draw (%3d,%2d): %s\n", x, y, str);
+}
+
+// Preset (de)serialisation is never exercised by the host tools; these only
+// satisfy the linker.
+void _NT_jsonStream::addMemberName(const char *) {}
+void _NT_jsonStream::addNumber(int) {}
+bool _NT_jsonParse::numberOfObjectMembers(int &num) {
+  num = 0;
+  return true;
+}
+bool _NT_jsonParse::matchName(const char *) { return false; }
+bool _NT_jsonParse::number(int &) { return false; }
+bool _NT_jsonParse::skipMember() { return true; }
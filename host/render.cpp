@@ -0,0 +1,191 @@
+// Offline renderer: runs the plugin's step() loop on the host and writes
+// Output A / Output B to a 32-bit float stereo WAV file.
+//
+//   nt_enosc_render -o out.wav [-d seconds] [-f frames] [-p "Name=value"]...
+
+#include "host_plugin.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+extern "C" void ntEnoscPrintLayout(const _NT_algorithmRequirements &req)
+    __attribute__((weak));
+// Only defined when the plugin is built with PROFILE=1
+extern "C" void ntEnoscPrintProfile(_NT_algorithm *self) __attribute__((weak));
+
+static void usage() {
+  fprintf(stderr,
+          "usage: nt_enosc_render [options]\n"
+          "  -o FILE        output WAV file (stereo float: Output A, Output B)\n"
+          "  -d SECONDS     duration to render (default 10)\n"
+          "  -f FRAMES      frames per step() call, multiple of 4 (default 32)\n"
+          "  -p NAME=VALUE  set a parameter (raw NT units) by name or index\n"
+          "  -s VALUE       next specification value (in factory order)\n"
+          "  -l             list parameters and exit\n"
+          "  -m             print memory requirements and exit\n"
+          "  -u             call draw() after rendering\n");
+}
+
+static void put_u16(FILE *file, uint16_t x) { fwrite(&x, 2, 1, file); }
+static void put_u32(FILE *file, uint32_t x) { fwrite(&x, 4, 1, file); }
+
+static void write_wav_header(FILE *file, uint32_t sample_rate,
+                             uint32_t num_frames) {
+  const uint16_t channels = 2;
+  const uint16_t bytes_per_sample = 4;
+  uint32_t data_bytes = num_frames * channels * bytes_per_sample;
+  fwrite("RIFF", 4, 1, file);
+  put_u32(file, 36 + data_bytes);
+  fwrite("WAVE", 4, 1, file);
+  fwrite("fmt ", 4, 1, file);
+  put_u32(file, 16);
+  put_u16(file, 3); // IEEE float
+  put_u16(file, channels);
+  put_u32(file, sample_rate);
+  put_u32(file, sample_rate * channels * bytes_per_sample);
+  put_u16(file, channels * bytes_per_sample);
+  put_u16(file, bytes_per_sample * 8);
+  fwrite("data", 4, 1, file);
+  put_u32(file, data_bytes);
+}
+
+static bool set_parameter(HostPlugin &plugin, const char *arg) {
+  const char *eq = strrchr(arg, '=');
+  if (eq == nullptr)
+    return false;
+  std::string name(arg, eq - arg);
+  int16_t value = int16_t(atoi(eq + 1));
+  char *end;
+  long index = strtol(name.c_str(), &end, 10);
+  if (*end == '\0' && index >= 0 && index < plugin.numParameters()) {
+    plugin.set(int(index), value);
+    return true;
+  }
+  return plugin.set(name.c_str(), value);
+}
+
+int main(int argc, char **argv) {
+  const char *out_path = nullptr;
+  float seconds = 10.0f;
+  int frames_per_step = 32;
+  std::vector<const char *> assignments;
+  std::vector<int32_t> specifications;
+  bool list = false;
+  bool memory = false;
+  bool draw = false;
+
+  for (int i = 1; i < argc; ++i) {
+    const char *arg = argv[i];
+    bool has_value = i + 1 < argc;
+    if (!strcmp(arg, "-o") && has_value) {
+      out_path = argv[++i];
+    } else if (!strcmp(arg, "-d") && has_value) {
+      seconds = float(atof(argv[++i]));
+    } else if (!strcmp(arg, "-f") && has_value) {
+      frames_per_step = atoi(argv[++i]);
+    } else if (!strcmp(arg, "-p") && has_value) {
+      assignments.push_back(argv[++i]);
+    } else if (!strcmp(arg, "-s") && has_value) {
+      specifications.push_back(atoi(argv[++i]));
+    } else if (!strcmp(arg, "-l")) {
+      list = true;
+    } else if (!strcmp(arg, "-m")) {
+      memory = true;
+    } else if (!strcmp(arg, "-u")) {
+      draw = true;
+    } else {
+      usage();
+      return 1;
+    }
+  }
+
+  const _NT_factory *factory = HostPlugin::load();
+  if (specifications.size() > factory->numSpecifications) {
+    fprintf(stderr, "the plugin has %u specifications\n",
+            factory->numSpecifications);
+    return 1;
+  }
+  for (uint32_t i = specifications.size(); i < factory->numSpecifications; ++i)
+    specifications.push_back(factory->specifications[i].def);
+  HostPlugin plugin(specifications.data());
+
+  if (list) {
+    for (int p = 0; p < plugin.numParameters(); ++p) {
+      const _NT_parameter &param = plugin.algorithm()->parameters[p];
+      printf("%2d  %-20s  %5d .. %5d  (default %d)\n", p, param.name,
+             param.min, param.max, param.def);
+    }
+    return 0;
+  }
+  if (memory) {
+    if (ntEnoscPrintLayout)
+      ntEnoscPrintLayout(plugin.requirements());
+    else
+      HostPlugin::print_requirements(plugin.requirements());
+    return 0;
+  }
+  if (out_path == nullptr || frames_per_step < 4 || frames_per_step % 4 != 0 ||
+      uint32_t(frames_per_step) > NT_globals.maxFramesPerStep) {
+    usage();
+    return 1;
+  }
+
+  for (const char *assignment : assignments) {
+    if (!set_parameter(plugin, assignment)) {
+      fprintf(stderr, "unknown parameter assignment '%s'\n", assignment);
+      return 1;
+    }
+  }
+
+  FILE *file = fopen(out_path, "wb");
+  if (file == nullptr) {
+    perror(out_path);
+    return 1;
+  }
+
+  const uint32_t sample_rate = NT_globals.sampleRate;
+  const int num_steps =
+      int(seconds * float(sample_rate) / float(frames_per_step) + 0.5f);
+  const uint32_t total_frames = uint32_t(num_steps * frames_per_step);
+  write_wav_header(file, sample_rate, total_frames);
+
+  std::vector<float> busses(HostPlugin::kNumBusses * frames_per_step);
+  std::vector<float> interleaved(2 * frames_per_step);
+  // kParamOutputA / kParamOutputB, looked up by name so the host does not
+  // depend on the plugin's parameter enum
+  const int out_a = plugin.bus(plugin.find("Output A"));
+  const int out_b = plugin.bus(plugin.find("Output B"));
+
+  double step_seconds = 0.0;
+  for (int s = 0; s < num_steps; ++s) {
+    std::fill(busses.begin(), busses.end(), 0.0f);
+    auto start = std::chrono::steady_clock::now();
+    plugin.step(busses.data(), frames_per_step);
+    step_seconds += std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - start)
+                        .count();
+    const float *a = &busses[out_a * frames_per_step];
+    const float *b = &busses[out_b * frames_per_step];
+    for (int i = 0; i < frames_per_step; ++i) {
+      interleaved[2 * i] = a[i];
+      interleaved[2 * i + 1] = b[i];
+    }
+    fwrite(interleaved.data(), sizeof(float), interleaved.size(), file);
+  }
+  fclose(file);
+
+  double audio_seconds = double(total_frames) / double(sample_rate);
+  printf("rendered %.2f s in %.3f s of step() time (%.1fx realtime)\n",
+         audio_seconds, step_seconds,
+         step_seconds > 0.0 ? audio_seconds / step_seconds : 0.0);
+  if (draw && plugin.factory()->draw)
+    plugin.factory()->draw(plugin.algorithm());
+  if (ntEnoscPrintProfile)
+    ntEnoscPrintProfile(plugin.algorithm());
+  return 0;
+}
@@ -0,0 +1,74 @@
+// Checks that SmootherBank glides land on their targets: for both profiles,
+// a range of smoothing times and every engine block size, each glide must
+// arrive exactly and drop out of the moving() mask within a bounded number
+// of advances. Prints one line per profile and exits non-zero if any glide
+// stalls short of its target.
+
+#include "smoothing.hh"
+
+#include <initializer_list>
+#include <math.h>
+#include <stdio.h>
+
+using Bank = SmootherBank<4>;
+
+static const float kSampleRate = 48000.0f;
+
+struct Glide {
+  float from, to;
+};
+
+// Parameter extremes (Pitch 0-127, Root 0-210), both ways, and small steps
+static const Glide kGlides[] = {
+    {0.0f, 127.0f}, {127.0f, 0.0f}, {0.0f, 210.0f}, {210.0f, 0.0f},
+    {-100.0f, 100.0f}, {64.0f, 65.0f}, {0.0f, 1.0f}, {126.0f, 127.0f},
+};
+static const int kTimesMs[] = {1, 10, 333, 2000};
+static const int kFrames[] = {8, 16, 32, 64};
+
+// Returns the advances the glide took to settle, or -1 if it did not within
+// `limit`
+static int settle(bool linear, float seconds, int frames, const Glide &g,
+                  int limit) {
+  Bank bank;
+  float steps[Bank::kPadded];
+  bank.set_step_storage(steps);
+  bank.set_alpha(Bank::alpha_for(seconds, frames, kSampleRate));
+  bank.set_rate(Bank::rate_for(seconds, frames, kSampleRate));
+  bank.set_linear(linear);
+  bank.set_hard(0, g.from);
+  bank.set_target(0, g.to);
+  for (int i = 1; i <= limit; ++i) {
+    bank.advance();
+    if (!bank.moving())
+      return bank[0] == g.to ? i : -1;
+  }
+  return -1;
+}
+
+int main() {
+  bool ok = true;
+  for (bool linear : {false, true}) {
+    int count = 0, stalled = 0;
+    for (int ms : kTimesMs)
+      for (int frames : kFrames)
+        for (const Glide &g : kGlides) {
+          const float seconds = ms / 1000.0f;
+          const float advances = seconds * kSampleRate / frames;
+          // The one-pole needs ln(distance / epsilon) time constants; the
+          // linear ramp arrives in the smoothing time, give or take rounding
+          const int limit =
+              int(ceilf(advances * (linear ? 1.05f : 20.0f))) + 2;
+          ++count;
+          if (settle(linear, seconds, frames, g, limit) < 0) {
+            if (stalled++ == 0)
+              printf("  %g -> %g over %d ms at %d frames did not settle\n",
+                     double(g.from), double(g.to), ms, frames);
+          }
+        }
+    printf("%-6s %4d glides  %3d stalled\n", linear ? "Live" : "Glide", count,
+           stalled);
+    ok &= stalled == 0;
+  }
+  return ok ? 0 : 1;
+}
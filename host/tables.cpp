@@ -0,0 +1,89 @@
+// Compares the lookup tables computed at load time (table_synth.cc) with the
+// ones gen.py generated into dynamic_data.cc and math.cc (so it is not built
+// with SYNTH_TABLES=1). Prints one line per table and exits non-zero if any
+// entry differs in its bit pattern.
+
+#include "dynamic_data.hh"
+#include "table_synth.hh"
+
+#include "./enosc/lib/easiglib/math.hh"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+template <typename T> static float value_of(const T &x) {
+  return float(x.repr());
+}
+
+struct Diff {
+  int mismatches = 0;
+  int count = 0;
+  double max_abs = 0.0;
+
+  template <typename T> void add(const T &synth, const T &ref, double a, double b) {
+    ++count;
+    if (memcmp(&synth, &ref, sizeof(T)) != 0)
+      ++mismatches;
+    max_abs = fmax(max_abs, fabs(a - b));
+  }
+
+  bool report(const char *name) const {
+    printf("%-9s %6d entries  %4d differ  max |diff| %.3g\n", name, count,
+           mismatches, max_abs);
+    return mismatches == 0;
+  }
+};
+
+int main() {
+  static DynamicData::Sine sine;
+  static DynamicData::Cheby cheby;
+  static DynamicData::Fold fold;
+  static DynamicData::FoldMax fold_max;
+  static uint32_t exp2[1024];
+
+  TableSynth::sine(sine);
+  TableSynth::cheby(cheby);
+  TableSynth::fold(fold, fold_max);
+  TableSynth::exp2(exp2);
+
+  bool ok = true;
+  Diff d;
+  for (int i = 0; i < sine_size; ++i) {
+    d.add(sine[i].first, DynamicData::sine_data[i].first,
+          value_of(sine[i].first), value_of(DynamicData::sine_data[i].first));
+    d.add(sine[i].second, DynamicData::sine_data[i].second,
+          value_of(sine[i].second), value_of(DynamicData::sine_data[i].second));
+  }
+  ok &= d.report("sine");
+
+  d = Diff();
+  for (int n = 0; n < cheby_tables; ++n)
+    for (int i = 0; i < cheby_size; ++i)
+      d.add(cheby[n][i], DynamicData::cheby_data[n][i], value_of(cheby[n][i]),
+            value_of(DynamicData::cheby_data[n][i]));
+  ok &= d.report("cheby");
+
+  d = Diff();
+  for (int i = 0; i < fold_size; ++i) {
+    d.add(fold[i].first, DynamicData::fold_data[i].first,
+          value_of(fold[i].first), value_of(DynamicData::fold_data[i].first));
+    d.add(fold[i].second, DynamicData::fold_data[i].second,
+          value_of(fold[i].second), value_of(DynamicData::fold_data[i].second));
+  }
+  ok &= d.report("fold");
+
+  d = Diff();
+  for (int i = 0; i < (fold_size - 1) / 2 + 1; ++i)
+    d.add(fold_max[i], DynamicData::fold_max_data[i], value_of(fold_max[i]),
+          value_of(DynamicData::fold_max_data[i]));
+  ok &= d.report("fold_max");
+
+  d = Diff();
+  for (int i = 0; i < 1024; ++i)
+    d.add(exp2[i], Math::exp2_table[i], double(exp2[i]),
+          double(Math::exp2_table[i]));
+  ok &= d.report("exp2");
+
+  return ok ? 0 : 1;
+}
@@ -1,5 +1,8 @@
 #include "math.hh"
 
+#ifdef SYNTHESIZE_TABLES
+uint32_t Math::exp2_table[1024];
+#else
 uint32_t Math::exp2_table[1024] = {
     8388608, 8394288, 8399972, 8405660, 8411351, 8417047, 8422746, 8428450,
     8434157, 8439868, 8445583, 8451301, 8457024, 8462751, 8468481, 8474215,
@@ -130,5 +133,6 @@ uint32_t Math::exp2_table[1024] = {
     16596492, 16607730, 16618975, 16630228, 16641489, 16652758, 16664034, 16675317,
     16686609, 16697908, 16709215, 16720529, 16731851, 16743180, 16754518, 16765863,
 };
+#endif
 
 Math::Math() { }
@@ -0,0 +1,81 @@
+#pragma once
+
+// Output-stage kernels that work on the engine's Q15 frames directly.
+//
+// The writers below turn one block of frames into bus samples for one
+// combination of output routing and replace/add modes, chosen by
+// select_writer() whenever those parameters change, so the per-sample loops
+// carry no mode tests and the compiler can vectorize them. Each writer reads
+// the whole block before writing anything: the block may have been rendered
+// into the very bus it is written to.
+
+#include "./enosc/src/parameters.hh"
+#include <string.h>
+
+namespace Mix {
+
+// Volts per unit of the engine's output
+static constexpr float kOutputGain = 5.0f;
+
+using Writer = void (*)(const Frame *in, float *outA, float *outB, int n);
+
+template <int N>
+inline void unpack(const Frame *in, float (&l)[N], float (&r)[N], int n) {
+  for (int i = 0; i < n; ++i) {
+    Frame frame;
+    memcpy(&frame, &in[i], sizeof(frame));
+    l[i] = Float(frame.l).repr() * kOutputGain;
+    r[i] = Float(frame.r).repr() * kOutputGain;
+  }
+}
+
+template <bool kReplace>
+inline void write(float *out, const float *in, int n) {
+  for (int i = 0; i < n; ++i) {
+    if constexpr (kReplace) {
+      out[i] = in[i];
+    } else {
+      out[i] += in[i];
+    }
+  }
+}
+
+// Output A and B on different buses
+template <int N, bool kReplaceA, bool kReplaceB>
+void write_split(const Frame *in, float *outA, float *outB, int n) {
+  float l[N], r[N];
+  unpack<N>(in, l, r, n);
+  write<kReplaceA>(outA, l, n);
+  write<kReplaceB>(outB, r, n);
+}
+
+// Both outputs on one bus with B adding: the bus gets L + R
+template <int N, bool kReplace>
+void write_sum(const Frame *in, float *out, float *, int n) {
+  float l[N], r[N];
+  unpack<N>(in, l, r, n);
+  write<kReplace>(out, l, n);
+  write<false>(out, r, n);
+}
+
+// Both outputs on one bus with B replacing: only R survives
+template <int N>
+void write_right(const Frame *in, float *, float *out, int n) {
+  float l[N], r[N];
+  unpack<N>(in, l, r, n);
+  write<true>(out, r, n);
+}
+
+template <int N>
+Writer select_writer(bool same_bus, bool replaceA, bool replaceB) {
+  if (same_bus) {
+    if (replaceB)
+      return write_right<N>;
+    return replaceA ? write_sum<N, true> : write_sum<N, false>;
+  }
+  if (replaceA)
+    return replaceB ? write_split<N, true, true> : write_split<N, true, false>;
+  return replaceB ? write_split<N, false, true> : write_split<N, false, false>;
+}
+
+} // namespace Mix
@@ -21,32 +21,116 @@
 #include "./enosc/src/parameters.hh"
 #include "./enosc/src/polyptic_oscillator.hh"
 #include "./enosc/src/quantizer.hh"
+#include "mix.hh"
+#include "event_queue.hh"
+#include "profile.hh"
+#include "smoothing.hh"
+#include "tables.hh"
 #include <algorithm>
+#include <type_traits>
+#ifdef NT_HOST
+#include <stdio.h>
+#endif
+
+// The controls that are smoothed, one SmootherBank lane each
+enum {
+  kSmoothBalance,
+  kSmoothRoot,
+  kSmoothPitch,
+  kSmoothSpread,
+  kSmoothDetune,
+  kSmoothModValue,
+  kSmoothTwistValue,
+  kSmoothWarpValue,
+#ifdef LEARN_ENABLED
+  kSmoothCrossfade,
+  kSmoothFineTune,
+  kSmoothNewNote,
+#endif
+  kNumSmoothed
+};
 
-// A simple class for parameter smoothing.
-class Smoother {
+static constexpr uint32_t lane(int l) { return 1u << l; }
+
+// Hides the step discontinuity when the engine output changes abruptly, e.g.
+// when the oscillator count changes under it. The difference between the
+// sample predicted from the previous block and the first sample of the new
+// one is added back as an offset that decays over a few milliseconds.
+class Declicker {
 public:
-  Smoother() : current_(0.0f), target_(0.0f), alpha_(0.0005f) {}
+  // Remember the tail of a block, for the next prediction
+  void track(float l1, float l0, float r1, float r0) {
+    prev_l_[0] = l0;
+    prev_l_[1] = l1;
+    prev_r_[0] = r0;
+    prev_r_[1] = r1;
+  }
 
-  void set_target(float target) { target_ = target; }
+  // Arm with the first sample of the block following a discontinuity
+  void trigger(float l, float r) {
+    offset_l_ = (2.0f * prev_l_[0] - prev_l_[1]) - l;
+    offset_r_ = (2.0f * prev_r_[0] - prev_r_[1]) - r;
+    active_ = true;
+  }
 
-  // Set target without interpolation
-  void set_hard(float value) {
-    target_ = value;
-    current_ = value;
+  bool active() const { return active_; }
+
+  void process(float &l, float &r) {
+    l += offset_l_;
+    r += offset_r_;
+    offset_l_ *= kDecay;
+    offset_r_ *= kDecay;
+    // Decided per sample, so where it ends does not depend on how the
+    // output is split across emit() calls
+    if (std::max(fabsf(offset_l_), fabsf(offset_r_)) <= 1e-5f) {
+      offset_l_ = offset_r_ = 0.0f;
+      active_ = false;
+    }
   }
 
-  float next() {
-    current_ += alpha_ * (target_ - current_);
-    return current_;
+private:
+  static constexpr float kDecay = 0.995f; // ~4 ms time constant at 48 kHz
+  float prev_l_[2] = {}, prev_r_[2] = {};
+  float offset_l_ = 0.0f, offset_r_ = 0.0f;
+  bool active_ = false;
+};
+
+// Lowers the oscillator count while step() exceeds a share of the realtime
+// budget and brings voices back once there is room, one at a time and with a
+// hold in between so the count does not hunt.
+class OscGovernor {
+public:
+  // load and budget in permille of the realtime budget; returns the new count
+  int update(int current, int max_osc, uint32_t load, uint32_t budget,
+             uint32_t frames, uint32_t sample_rate) {
+    load_ += (float(load) - load_) * 0.05f;
+    if (hold_ > frames) {
+      hold_ -= frames;
+      return current;
+    }
+    hold_ = 0;
+    if (current > 1 && load_ > float(budget)) {
+      hold_ = sample_rate / 20; // 50 ms
+      return current - 1;
+    }
+    // Only add a voice when the estimate with one more still fits with a
+    // 10% margin; waits longer than when shedding voices
+    float per_osc = load_ / float(current);
+    if (current < max_osc && load_ + per_osc < 0.9f * float(budget)) {
+      hold_ = sample_rate / 4; // 250 ms
+      return current + 1;
+    }
+    return current;
   }
 
-  float current() const { return current_; }
+  void reset() {
+    load_ = 0.0f;
+    hold_ = 0;
+  }
 
 private:
-  float current_;
-  float target_;
-  float alpha_;
+  float load_ = 0.0f;
+  uint32_t hold_ = 0;
 };
 
 // Plugin parameters mapping to EnOSC engine Parameters
@@ -81,6 +165,11 @@ enum {
   kParamStereoMode,
   kParamFreezeMode,
   kParamFreeze,
+  kParamLoadDisplay,
+  kParamCpuBudget,
+  kParamSmoothing,
+  kParamSmoothProfile,
+  kParamCvRate,
 #ifdef LEARN_ENABLED
   kParamLearn,
   kParamCrossfade,
@@ -104,6 +193,11 @@ static const char *const enumSplit[] = {"Alternate", "Lo/Hi", "Lowest/Rest"};
 static const char *const enumFreeze[] = {"Off", "On"};
 static const char *const enumLearn[] = {"Off", "On"};
 static const char *const enumAction[] = {"Off", "On"};
+static const char *const enumDisplay[] = {"Off", "On"};
+// Exponential approach, or linear ramps that arrive in the smoothing time
+static const char *const enumSmoothProfile[] = {"Glide", "Live"};
+// First, last or mean sample of each engine block; all are block-rate
+static const char *const enumCvRate[] = {"Block", "Latest", "Filtered"};
 
 const int kNumBusses = 28;
 
@@ -138,6 +232,12 @@ static const _NT_parameter parameters[] = {
     {.name = "Stereo mode", .min = 0, .max = 2, .def = 0, .unit = kNT_unitEnum, .scaling = 0, .enumStrings = enumSplit},
     {.name = "Freeze mode", .min = 0, .max = 2, .def = 0, .unit = kNT_unitEnum, .scaling = 0, .enumStrings = enumSplit},
     {.name = "Freeze", .min = 0, .max = 1, .def = 0, .unit = kNT_unitEnum, .scaling = 0, .enumStrings = enumFreeze},
+    {.name = "Load display", .min = 0, .max = 1, .def = 0, .unit = kNT_unitEnum, .scaling = 0, .enumStrings = enumDisplay},
+    // 0 = off, otherwise the share of the realtime budget step() may use
+    {.name = "CPU budget", .min = 0, .max = 100, .def = 0, .unit = kNT_unitPercent, .scaling = 0, .enumStrings = NULL},
+    {.name = "Smoothing", .min = 1, .max = 2000, .def = 333, .unit = kNT_unitMs, .scaling = 0, .enumStrings = NULL},
+    {.name = "Smooth profile", .min = 0, .max = 1, .def = 0, .unit = kNT_unitEnum, .scaling = 0, .enumStrings = enumSmoothProfile},
+    {.name = "CV rate", .min = 0, .max = 2, .def = 0, .unit = kNT_unitEnum, .scaling = 0, .enumStrings = enumCvRate},
 #ifdef LEARN_ENABLED
     {.name = "Learn", .min = 0, .max = 1, .def = 0, .unit = kNT_unitEnum, .scaling = 0, .enumStrings = enumLearn},
     {.name = "Crossfade", .min = 0, .max = 100, .def = 12, .unit = kNT_unitPercent, .scaling = 0, .enumStrings = NULL}, // 12% approx 0.125 internal
@@ -151,157 +251,400 @@ static const _NT_parameter parameters[] = {
 };
 // clang-format off
 
+// Specifications, chosen when the algorithm is added to a preset
+enum {
+  kSpecBlockSize,
+  kNumSpecifications
+};
+
+// Engine block sizes an instance can be built with: kBlockSize << n
+static constexpr int kNumBlockSizes = 4;
+static constexpr int kMaxBlockSize = kBlockSize << (kNumBlockSizes - 1);
+
+static const _NT_specification specifications[] = {
+    // Engine block of kBlockSize << n frames: 0 = 8 (lowest control latency) .. 3 = 64 (least CPU)
+    {.name = "Engine block", .min = 0, .max = kNumBlockSizes - 1, .def = 0, .type = kNT_typeGeneric},
+};
+
 // Forward declaration for parameterChanged
 void parameterChanged(_NT_algorithm *self, int p);
 
-// DTC struct holds algorithm state and oscillator instance
+// DTC struct holds the hot state: everything step() touches on every block
+// or sample. Anything read only on parameter changes or by draw() belongs in
+// _ntEnosc_Alg, which lives in SRAM. The engine itself follows it in DTC; see
+// _ntEnosc_Engine.
 struct _ntEnosc_DTC {
   Parameters params;
-  PolypticOscillator<kBlockSize> osc;
-  Scale *current_scale;
+  // Oscillator count to switch to at the next block boundary; written by
+  // parameterChanged() and the CPU governor, applied by step()
   std::atomic<int> next_num_osc;
-  Buffer<Frame, kBlockSize> blk;
-
-  // Smoothers
-  Smoother s_balance;
-  Smoother s_root;
-  Smoother s_pitch;
-  Smoother s_spread;
-  Smoother s_detune;
-  Smoother s_mod_value;
-  Smoother s_twist_value;
-  Smoother s_warp_value;
-#ifdef LEARN_ENABLED
-  Smoother s_crossfade;
-  Smoother s_fine_tune;
-  Smoother s_new_note;
+  Declicker declick;
+  // The next block starts with a jump for the declicker to cover
+  bool discontinuity = false;
+  // Warp is at exactly 0% in FOLD mode and the engine bypasses the fold
+  bool fold_bypass = false;
+  // A block has been rendered, so there is output for the declicker to join
+  bool rendered = false;
+  // Frames of _ntEnosc_Engine::carry still to be written out
+  int carry_count = 0;
+
+  // Controls are only remapped when a smoother lane moves, a CV input changes or
+  // a parameter was set; see updateControls()
+  bool controls_dirty = true;
+  float last_pitch_cv = 0.0f;
+  float last_root_cv = 0.0f;
+
+  // Indexed by kSmoothBalance etc.
+  SmootherBank<kNumSmoothed> smooth;
+};
+
+// The parts of the hot state whose size depends on the "Engine block"
+// specification, placed in DTC after _ntEnosc_DTC
+template <int N> struct _ntEnosc_Engine {
+  PolypticOscillator<N> osc;
+  // Render-ahead FIFO: when a step() ends partway through a block, the
+  // block is rendered here and its last carry_count frames are written out
+  // at the start of the next step()
+  Buffer<Frame, N> carry;
+
+  _ntEnosc_Engine(Parameters &params) : osc(params) {}
+};
+
+static constexpr uint32_t kEngineOffset = (sizeof(_ntEnosc_DTC) + 15) & ~15u;
+
+// Calls fn with std::integral_constant<int, N> for the engine block size
+// that a value of the "Engine block" specification stands for
+template <typename F> static void withBlockSize(int spec, F &&fn) {
+  switch (spec) {
+  case 0: fn(std::integral_constant<int, kBlockSize>()); break;
+  case 1: fn(std::integral_constant<int, (kBlockSize << 1)>()); break;
+  case 2: fn(std::integral_constant<int, (kBlockSize << 2)>()); break;
+  default: fn(std::integral_constant<int, (kBlockSize << 3)>()); break;
+  }
+}
+
+#ifdef NT_PROFILE
+// Stages of step(), in the order they run within each engine block
+enum {
+  kStageCvRead,
+  kStageSmoothers,
+  kStageMapping,
+  kStageProcess,
+  kStageOutput,
+  kNumStages
+};
+static const char *const stageNames[kNumStages] = {"cv", "smooth", "map",
+                                                   "process", "output"};
+using Profiler = StageProfiler<kNumStages, 32>;
+#define PROFILE_BEGIN() alg->profiler.begin()
+#define PROFILE_MARK(stage) alg->profiler.mark(stage)
+#define PROFILE_END() alg->profiler.end()
+#else
+#define PROFILE_BEGIN()
+#define PROFILE_MARK(stage)
+#define PROFILE_END()
 #endif
 
-  int16_t prev_kParamLearn_val = 0;
-  float dtc_manual_learn_offset = 0;
+// What the load display shows, published by step() once per call
+struct LoadSnapshot {
+  uint32_t cycles_per_block; // average over the blocks of the last step()
+  uint32_t peak_per_block;   // worst step() within the last second
+  uint16_t load_permille;    // of the per-sample realtime budget
+  uint8_t num_osc;
+  uint8_t twist_mode;
+  uint8_t warp_mode;
+};
+
+// Output and CV routing as last applied, with the writer chosen for it; see
+// setRouting(). render() reads only this, so the buses it writes and the
+// writer it writes them with always agree.
+struct Routing {
+  int chanA = 0, chanB = 0;
+  bool replaceA = false, replaceB = false;
+  Mix::Writer writer = nullptr;
+  // CV inputs: bus indices and the "CV rate"
+  int pitch_cv_chan = 0, root_cv_chan = 0;
+  int cv_rate = 0;
+};
 
-  _ntEnosc_DTC(_NT_algorithm *self) : osc(params) {}
+// A parameterChanged() call, carried over to the audio thread
+struct ParamEvent {
+  int16_t param;
+  int16_t value;
 };
 
+// Algorithm struct (SRAM) holds the cold state: learn bookkeeping, the load
+// display and governor, and the per-instance parameter table
 struct _ntEnosc_Alg : public _NT_algorithm {
   _ntEnosc_Alg(_ntEnosc_DTC *d) : dtc(d) {}
   _ntEnosc_DTC *dtc;
+  void *engine = nullptr; // _ntEnosc_Engine<kBlockSize << block_spec>
+  int block_spec = 0;
+
+  // The instance's copies of the tables (FAST_TABLES); see Tables::instance()
+  TableSet tables;
+  Scale *current_scale = nullptr;
+  int16_t prev_kParamLearn_val = 0;
+  float manual_learn_offset = 0;
+
+  SnapshotBuffer<LoadSnapshot> load;
+  uint32_t peak_per_block = 0;
+  uint32_t peak_frames = 0; // frames since the peak was last reset
+
+  OscGovernor governor;
+  // Governor settings as last applied; step() reads these, not v[]
+  int cpu_budget = 0;
+  int max_osc = 0;
+  // Output routing parameters as last applied, from which setRouting()
+  // derives the routing in DTC
+  int16_t output_a = 0, output_a_mode = 0, output_b = 0, output_b_mode = 0;
+  // Read once per step()
+  Routing routing;
+  // Increments of the smoothers' linear ramps; see SmootherBank
+  float smooth_steps[SmootherBank<kNumSmoothed>::kPadded] = {};
+
+  // Parameter changes for step() to apply at its next block boundary; see
+  // applyEvents()
+  SpscQueue<ParamEvent, 64> events;
+  // Set when the queue was full: step() reapplies everything from v[]
+  std::atomic<bool> resync{false};
+
+#ifdef NT_PROFILE
+  // Read-only outside step(); lives in SRAM to keep DTC for the engine
+  Profiler profiler;
+#endif
 };
 
+// Calls fn with the instance's engine, typed for its block size. step()
+// dispatches through this too: one switch per call is lost in the noise, and
+// the per-mode kernels are chosen inside Process(), out of the wrapper's
+// reach.
+template <typename F> static void withEngine(_ntEnosc_Alg *alg, F &&fn) {
+  withBlockSize(alg->block_spec, [&](auto n) {
+    fn(*(_ntEnosc_Engine<decltype(n)::value> *)alg->engine);
+  });
+}
+
+// The smoothers advance once per engine block, so the coefficient for a
+// given time constant depends on the block size and the sample rate
+static void setSmoothingTime(_ntEnosc_Alg *alg, int ms) {
+  using Bank = SmootherBank<kNumSmoothed>;
+  const int frames = kBlockSize << alg->block_spec;
+  alg->dtc->smooth.set_alpha(
+      Bank::alpha_for(ms / 1000.0f, frames, NT_globals.sampleRate));
+  alg->dtc->smooth.set_rate(
+      Bank::rate_for(ms / 1000.0f, frames, NT_globals.sampleRate));
+}
+
+// Index into busFrames of a bus parameter's value
+static int busIndex(int bus) {
+  constexpr int MAX_CHAN = 27;
+  return std::clamp(bus - 1, 0, MAX_CHAN);
+}
 
+// Sets the output buses and modes from the applied routing parameters,
+// together with the writer for them
+static void setRouting(_ntEnosc_Alg *alg) {
+  Routing &r = alg->routing;
+  r.chanA = busIndex(alg->output_a);
+  r.chanB = busIndex(alg->output_b);
+  r.replaceB = alg->output_b_mode != 0;
+  // On one bus, B replacing wipes whatever A wrote, so A may as well
+  // replace too; that keeps A from reading a block rendered in place
+  r.replaceA =
+      alg->output_a_mode != 0 || (r.chanA == r.chanB && r.replaceB);
+  r.writer = Mix::select_writer<kMaxBlockSize>(r.chanA == r.chanB,
+                                               r.replaceA, r.replaceB);
+}
 
 void calculateStaticRequirements(_NT_staticRequirements &req) {
-  req.dram = 0;
+  req.dram = Tables::sharedBytes();
 }
 
-void initialise(_NT_staticMemoryPtrs &ptrs, const _NT_staticRequirements &req) {}
+void initialise(_NT_staticMemoryPtrs &ptrs, const _NT_staticRequirements &req) {
+  Tables::initialise(ptrs.dram);
+  // The load display and the CPU governor read the cycle counter in every
+  // build, not just with NT_PROFILE
+  CycleCounter::enable();
+}
 
-void calculateRequirements(_NT_algorithmRequirements &req, const int32_t *) {
+void calculateRequirements(_NT_algorithmRequirements &req,
+                           const int32_t *specifications) {
   req.numParameters = kNumParams;
   req.sram = sizeof(_ntEnosc_Alg);
-  req.dtc = sizeof(_ntEnosc_DTC);
-  req.itc = 0;
+  req.dram = 0;
+  withBlockSize(specifications[kSpecBlockSize], [&](auto n) {
+    req.dtc = kEngineOffset + sizeof(_ntEnosc_Engine<decltype(n)::value>);
+  });
+  req.itc = Tables::instanceBytes();
 }
 
 _NT_algorithm *construct(const _NT_algorithmMemoryPtrs &ptrs,
                          const _NT_algorithmRequirements &req,
-                         const int32_t *) {
+                         const int32_t *specifications) {
   auto *alg = new (ptrs.sram) _ntEnosc_Alg(nullptr);
   alg->parameters = parameters;
   alg->parameterPages = nullptr;
-  auto *d = new (ptrs.dtc) _ntEnosc_DTC(alg);
+  alg->tables = Tables::instance(ptrs.itc);
+  auto *d = new (ptrs.dtc) _ntEnosc_DTC();
   alg->dtc = d;
+  alg->block_spec = specifications[kSpecBlockSize];
+  withBlockSize(alg->block_spec, [&](auto n) {
+    alg->engine = new (ptrs.dtc + kEngineOffset)
+        _ntEnosc_Engine<decltype(n)::value>(d->params);
+  });
+  d->params.alt.numOsc = parameters[kParamNumOsc].def;
+  d->next_num_osc.store(parameters[kParamNumOsc].def);
+  alg->output_a = parameters[kParamOutputA].def;
+  alg->output_a_mode = parameters[kParamOutputAMode].def;
+  alg->output_b = parameters[kParamOutputB].def;
+  alg->output_b_mode = parameters[kParamOutputBMode].def;
+  setRouting(alg);
+  alg->routing.pitch_cv_chan = busIndex(parameters[kParamPitchCV].def);
+  alg->routing.root_cv_chan = busIndex(parameters[kParamRootCV].def);
+  alg->routing.cv_rate = parameters[kParamCvRate].def;
+  alg->cpu_budget = parameters[kParamCpuBudget].def;
+  alg->max_osc = parameters[kParamNumOsc].def;
 
   // Initialize smoothers with default values from parameters array
-  d->s_balance.set_hard(parameters[kParamBalance].def);
-  d->s_root.set_hard(parameters[kParamRoot].def);
-  d->s_pitch.set_hard(parameters[kParamPitch].def);
-  d->s_spread.set_hard(parameters[kParamSpread].def);
-  d->s_detune.set_hard(parameters[kParamDetune].def);
-  d->s_mod_value.set_hard(parameters[kParamModValue].def);
-  d->s_twist_value.set_hard(parameters[kParamTwistValue].def);
-  d->s_warp_value.set_hard(parameters[kParamWarpValue].def);
+  static const struct {
+    int lane, param;
+  } smoothed[] = {
+      {kSmoothBalance, kParamBalance},     {kSmoothRoot, kParamRoot},
+      {kSmoothPitch, kParamPitch},         {kSmoothSpread, kParamSpread},
+      {kSmoothDetune, kParamDetune},       {kSmoothModValue, kParamModValue},
+      {kSmoothTwistValue, kParamTwistValue},
+      {kSmoothWarpValue, kParamWarpValue},
 #ifdef LEARN_ENABLED
-  d->s_crossfade.set_hard(parameters[kParamCrossfade].def);
-  d->s_fine_tune.set_hard(parameters[kParamFineTune].def);
-  d->s_new_note.set_hard(parameters[kParamNewNote].def);
+      {kSmoothCrossfade, kParamCrossfade}, {kSmoothFineTune, kParamFineTune},
+      {kSmoothNewNote, kParamNewNote},
 #endif
+  };
+  d->smooth.set_step_storage(alg->smooth_steps);
+  for (const auto &s : smoothed)
+    d->smooth.set_hard(s.lane, parameters[s.param].def);
+  setSmoothingTime(alg, parameters[kParamSmoothing].def);
+  d->smooth.set_linear(parameters[kParamSmoothProfile].def != 0);
 
   return alg;
 }
 
+// Changes that step() could apply halfway through a block, or that touch the
+// engine, are not made here but queued for step() to make at its next block
+// boundary. A full queue (more than a preset load's worth of changes between
+// two step() calls) falls back to a full resync.
 void parameterChanged(_NT_algorithm *self, int p) {
   _ntEnosc_Alg *a = (_ntEnosc_Alg *)self;
+  if (!a->events.push({int16_t(p), self->v[p]}))
+    a->resync.store(true, std::memory_order_release);
+}
+
+// One-shot actions, which a resync must not repeat
+static bool isAction(int p) {
+  switch (p) {
+#ifdef LEARN_ENABLED
+  case kParamAddNote:
+  case kParamRemoveLastNote:
+  case kParamResetScale:
+    return true;
+#endif
+  default:
+    return false;
+  }
+}
+
+// Makes a parameter change on the audio thread
+static void applyParameter(_ntEnosc_Alg *a, int p, int16_t val) {
   auto &params = a->dtc->params;
-  int16_t val = self->v[p];
+  a->dtc->controls_dirty = true;
 
   switch (p) {
 #ifdef LEARN_ENABLED
   case kParamLearn: {
-    int16_t prev_learn_val = a->dtc->prev_kParamLearn_val;
+    int16_t prev_learn_val = a->prev_kParamLearn_val;
     if (val == 1 && prev_learn_val == 0) {
-      a->dtc->osc.enable_learn();
-      a->dtc->osc.enable_pre_listen();
-      a->dtc->dtc_manual_learn_offset =
-          a->dtc->s_pitch.current() - (a->dtc->s_root.current() / 10.0f);
+      withEngine(a, [&](auto &e) {
+        e.osc.enable_learn();
+        e.osc.enable_pre_listen();
+      });
+      a->manual_learn_offset =
+          a->dtc->smooth[kSmoothPitch] - (a->dtc->smooth[kSmoothRoot] / 10.0f);
     } else if (val == 0 && prev_learn_val == 1) {
-      a->dtc->osc.disable_learn();
+      withEngine(a, [&](auto &e) { e.osc.disable_learn(); });
     }
-    a->dtc->prev_kParamLearn_val = val;
+    a->prev_kParamLearn_val = val;
     break;
   }
   case kParamManualLearn: {
     if (bool(val)) {
-      a->dtc->osc.enable_pre_listen();
-      a->dtc->osc.enable_follow_new_note();
-      params.new_note = f(a->dtc->s_pitch.current());
+      withEngine(a, [&](auto &e) {
+        e.osc.enable_pre_listen();
+        e.osc.enable_follow_new_note();
+      });
+      params.new_note = f(a->dtc->smooth[kSmoothPitch]);
     } else {
-      a->dtc->osc.disable_follow_new_note();
+      withEngine(a, [&](auto &e) { e.osc.disable_follow_new_note(); });
     }
     break;
   }
 #endif
   case kParamFreeze: {
-    a->dtc->osc.set_freeze(bool(val));
+    withEngine(a, [&](auto &e) { e.osc.set_freeze(bool(val)); });
     break;
   }
-  case kParamBalance: a->dtc->s_balance.set_target(val); break;
-  case kParamRoot: a->dtc->s_root.set_target(val); break;
-  case kParamPitch: a->dtc->s_pitch.set_target(val); break;
-  case kParamSpread: a->dtc->s_spread.set_target(val); break;
-  case kParamDetune: a->dtc->s_detune.set_target(val); break;
-  case kParamModValue: a->dtc->s_mod_value.set_target(val); break;
-  case kParamTwistValue: a->dtc->s_twist_value.set_target(val); break;
-  case kParamWarpValue: a->dtc->s_warp_value.set_target(val); break;
+  case kParamBalance: a->dtc->smooth.set_target(kSmoothBalance, val); break;
+  case kParamRoot: a->dtc->smooth.set_target(kSmoothRoot, val); break;
+  case kParamPitch: a->dtc->smooth.set_target(kSmoothPitch, val); break;
+  case kParamSpread: a->dtc->smooth.set_target(kSmoothSpread, val); break;
+  case kParamDetune: a->dtc->smooth.set_target(kSmoothDetune, val); break;
+  case kParamModValue: a->dtc->smooth.set_target(kSmoothModValue, val); break;
+  case kParamTwistValue: a->dtc->smooth.set_target(kSmoothTwistValue, val); break;
+  case kParamWarpValue: a->dtc->smooth.set_target(kSmoothWarpValue, val); break;
 #ifdef LEARN_ENABLED
-  case kParamCrossfade: a->dtc->s_crossfade.set_target(val); break;
-  case kParamFineTune: a->dtc->s_fine_tune.set_target(val); break;
-  case kParamNewNote: a->dtc->s_new_note.set_target(val); break;
+  case kParamCrossfade: a->dtc->smooth.set_target(kSmoothCrossfade, val); break;
+  case kParamFineTune: a->dtc->smooth.set_target(kSmoothFineTune, val); break;
+  case kParamNewNote: a->dtc->smooth.set_target(kSmoothNewNote, val); break;
 #endif
   case kParamModMode: params.modulation.mode = ModulationMode(val); break;
   case kParamScaleMode: params.scale.mode = ScaleMode(val); break;
   case kParamScaleValue: params.scale.value = val; break;
   case kParamTwistMode: params.twist.mode = TwistMode(val); break;
   case kParamWarpMode: params.warp.mode = WarpMode(val); break;
-  case kParamNumOsc: params.alt.numOsc = val; break;
+  case kParamNumOsc:
+    a->max_osc = val;
+    a->dtc->next_num_osc.store(val);
+    break;
+  case kParamCpuBudget:
+    a->cpu_budget = val;
+    a->governor.reset();
+    break;
+  case kParamSmoothing: setSmoothingTime(a, val); break;
+  case kParamSmoothProfile: a->dtc->smooth.set_linear(val != 0); break;
+  case kParamOutputA: a->output_a = val; setRouting(a); break;
+  case kParamOutputAMode: a->output_a_mode = val; setRouting(a); break;
+  case kParamOutputB: a->output_b = val; setRouting(a); break;
+  case kParamOutputBMode: a->output_b_mode = val; setRouting(a); break;
+  case kParamPitchCV: a->routing.pitch_cv_chan = busIndex(val); break;
+  case kParamRootCV: a->routing.root_cv_chan = busIndex(val); break;
+  case kParamCvRate: a->routing.cv_rate = val; break;
   case kParamStereoMode: params.alt.stereo_mode = static_cast<SplitMode>(val); break;
   case kParamFreezeMode: params.alt.freeze_mode = static_cast<SplitMode>(val); break;
 #ifdef LEARN_ENABLED
   case kParamAddNote:
     if (bool(val)) {
       float note_to_add_float = params.new_note.repr() +
-                                a->dtc->dtc_manual_learn_offset +
+                                a->manual_learn_offset +
                                 params.fine_tune.repr();
       float clamped_note_float =
           std::clamp(note_to_add_float, 0.0f, 127.0f);
-      a->dtc->osc.new_note(f(clamped_note_float));
+      withEngine(a, [&](auto &e) { e.osc.new_note(f(clamped_note_float)); });
     }
     break;
   case kParamRemoveLastNote:
-    if (bool(val)) { a->dtc->osc.remove_last_note(); }
+    if (bool(val)) { withEngine(a, [&](auto &e) { e.osc.remove_last_note(); }); }
     break;
   case kParamResetScale:
-    if (bool(val)) { a->dtc->osc.reset_current_scale(); }
+    if (bool(val)) { withEngine(a, [&](auto &e) { e.osc.reset_current_scale(); }); }
     break;
 #endif
   default:
@@ -309,104 +652,399 @@ void parameterChanged(_NT_algorithm *self, int p) {
   }
 }
 
-void step(_NT_algorithm *self, float *busFrames, int numFramesBy4) {
-  auto *alg = (_ntEnosc_Alg *)self;
-  auto *dtc = alg->dtc;
-
-  const int numFrames = numFramesBy4 * 4;
-
-  int chanA = int(self->v[kParamOutputA]) - 1;
-  int chanB = int(self->v[kParamOutputB]) - 1;
-  constexpr int MAX_CHAN = 27;
-  chanA = std::clamp(chanA, 0, MAX_CHAN);
-  chanB = std::clamp(chanB, 0, MAX_CHAN);
+// Applies the queued parameter changes, oldest first. Called at the start of
+// step(), which need not be an engine block boundary: the frames carried over
+// from the last block were rendered already and go out first, so engine
+// parameters take effect at the next block rendered, and every block renders
+// with one consistent set of them. Routing changes apply to the whole step(),
+// the carried frames included.
+static void applyEvents(_ntEnosc_Alg *alg) {
+  ParamEvent e;
+  while (alg->events.pop(e))
+    applyParameter(alg, e.param, e.value);
+  if (alg->resync.exchange(false, std::memory_order_acquire)) {
+    for (int p = 0; p < kNumParams; ++p) {
+      if (!isAction(p))
+        applyParameter(alg, p, alg->v[p]);
+    }
+  }
+}
 
-  int pitch_cv_bus_idx = int(self->v[kParamPitchCV]) - 1;
-  int root_cv_bus_idx = int(self->v[kParamRootCV]) - 1;
-  pitch_cv_bus_idx = std::clamp(pitch_cv_bus_idx, 0, MAX_CHAN);
-  root_cv_bus_idx = std::clamp(root_cv_bus_idx, 0, MAX_CHAN);
+// Where Process() renders a block that is written out whole. A Frame is the
+// size of one float sample, so the block can be rendered into the first N
+// samples of the output bus it is about to replace and converted there in
+// place, front to back. When neither output replaces, it goes through the
+// firmware's work buffer, if that can hold a block; otherwise there is
+// nowhere to render in place and this returns null.
+template <int N>
+static Buffer<Frame, N> *renderTarget(const Routing &routing, float *outA,
+                                      float *outB) {
+  static_assert(sizeof(Frame) == sizeof(float),
+                "a Frame must fit in one bus sample");
+  if (routing.replaceA)
+    return (Buffer<Frame, N> *)outA;
+  if (routing.replaceB)
+    return (Buffer<Frame, N> *)outB;
+  if (NT_globals.workBufferSizeBytes >= sizeof(Buffer<Frame, N>))
+    return (Buffer<Frame, N> *)NT_globals.workBuffer;
+  return nullptr;
+}
 
-  float *outA = busFrames + chanA * numFrames;
-  float *outB = busFrames + chanB * numFrames;
+// Writes n frames to the output buses: through the routing's writer, or
+// sample by sample while the declicker is active
+static void emit(_ntEnosc_DTC *dtc, const Routing &routing, const Frame *in,
+                 float *outA, float *outB, int n) {
+  if (!dtc->declick.active()) {
+    routing.writer(in, outA, outB, n);
+    return;
+  }
+  for (int i = 0; i < n; ++i) {
+    // Copied out byte-wise: the frame and the float written over it below
+    // may share storage, and must not be reordered
+    Frame fr;
+    std::memcpy(&fr, &in[i], sizeof(fr));
+    float sampleL = Float(fr.l).repr() * 5.0f;
+    float sampleR = Float(fr.r).repr() * 5.0f;
+    dtc->declick.process(sampleL, sampleR);
+
+    if (routing.replaceA) {
+      outA[i] = sampleL;
+    } else {
+      outA[i] += sampleL;
+    }
+    if (routing.replaceB) {
+      outB[i] = sampleR;
+    } else {
+      outB[i] += sampleR;
+    }
+  }
+}
 
-  bool replaceA = (self->v[kParamOutputAMode] != 0);
-  bool replaceB = (self->v[kParamOutputBMode] != 0);
+// Advances the smoothers and maps the controls onto the engine parameters
+// for the next block. Only the parameters whose lanes moved or whose CV
+// changed are recomputed, unless `all` is set.
+static void updateControls(_ntEnosc_Alg *alg, float pitch_cv, float root_cv,
+                           bool pitch_cv_changed, bool root_cv_changed,
+                           bool all) {
+  auto *dtc = alg->dtc;
 
-  constexpr int BS = kBlockSize;
+  // With everything dirty, every lane counts as moved
+  const uint32_t moved = dtc->smooth.advance() | (all ? ~0u : 0u);
+  const auto &sm = dtc->smooth;
+  PROFILE_MARK(kStageSmoothers);
 
-  for (int frame = 0; frame < numFrames; frame += BS) {
-    float smoothed_balance = dtc->s_balance.next();
-    f balance = f(smoothed_balance / 100.f);
+  if (moved & lane(kSmoothBalance)) {
+    f balance = f(sm[kSmoothBalance] / 100.f);
     balance *= balance * balance;
     balance *= 4.0_f;
     dtc->params.balance = Math::fast_exp2(balance);
+  }
 
-    float smoothed_spread = dtc->s_spread.next();
-    f spread_val = f(smoothed_spread);
+  if (moved & lane(kSmoothSpread)) {
+    f spread_val = f(sm[kSmoothSpread]);
     spread_val *= f(10.0f / 16.0f);
     dtc->params.spread = spread_val;
+  }
 
-    float smoothed_detune = dtc->s_detune.next();
-    f detune_val = f(smoothed_detune / 100.f);
+  if (moved & lane(kSmoothDetune)) {
+    f detune_val = f(sm[kSmoothDetune] / 100.f);
     detune_val = (detune_val * detune_val) * (detune_val * detune_val);
     detune_val *= f(10.0f / 16.0f);
     dtc->params.detune = detune_val;
+  }
 
-    dtc->params.modulation.value = f(dtc->s_mod_value.next() / 100.f);
-    dtc->params.twist.value = f(dtc->s_twist_value.next() / 100.f);
-    float warp_raw = dtc->s_warp_value.next() / 100.f;
-    // FOLD mode bypasses at ≤0.005, causing a click. Keep above threshold.
-    if (dtc->params.warp.mode == FOLD && warp_raw < 0.006f) {
+  if (moved & lane(kSmoothModValue))
+    dtc->params.modulation.value = f(sm[kSmoothModValue] / 100.f);
+  if (moved & lane(kSmoothTwistValue))
+    dtc->params.twist.value = f(sm[kSmoothTwistValue] / 100.f);
+  if (moved & lane(kSmoothWarpValue)) {
+    float warp_raw = sm[kSmoothWarpValue] / 100.f;
+    // FOLD mode bypasses at ≤0.005, which is far cheaper but clicks against
+    // the lightest fold. Let it bypass only once Warp has come to rest at 0%,
+    // with the declicker covering the jump, and keep above the threshold on
+    // the way there.
+    const bool bypass = dtc->params.warp.mode == FOLD && warp_raw == 0.0f;
+    if (dtc->params.warp.mode == FOLD && !bypass && warp_raw < 0.006f) {
       warp_raw = 0.006f;
     }
+    // Before the first block this only syncs with the applied parameters;
+    // there is no output yet to jump from
+    if (bypass != dtc->fold_bypass) {
+      dtc->fold_bypass = bypass;
+      dtc->discontinuity = dtc->rendered;
+    }
     dtc->params.warp.value = f(warp_raw);
+  }
 
 #ifdef LEARN_ENABLED
-    dtc->params.alt.crossfade_factor = f(dtc->s_crossfade.next() / 100.f);
-    dtc->params.fine_tune = f(dtc->s_fine_tune.next() / 100.f);
-    dtc->params.new_note = f(dtc->s_new_note.next());
+  if (moved & lane(kSmoothCrossfade))
+    dtc->params.alt.crossfade_factor = f(sm[kSmoothCrossfade] / 100.f);
+  if (moved & lane(kSmoothFineTune))
+    dtc->params.fine_tune = f(sm[kSmoothFineTune] / 100.f);
+  if (moved & lane(kSmoothNewNote))
+    dtc->params.new_note = f(sm[kSmoothNewNote]);
 #endif
 
-    f current_pitch_cv_value =
-        f(busFrames[pitch_cv_bus_idx * numFrames + frame] * 12.0f);
-    f current_root_cv_value =
-        f(busFrames[root_cv_bus_idx * numFrames + frame] * 12.0f);
-
-    float pitch_pot_base = dtc->s_pitch.next();
-    float root_panel_value = dtc->s_root.next();
+  if (pitch_cv_changed || (moved & (lane(kSmoothPitch)
+#ifdef LEARN_ENABLED
+                                    | lane(kSmoothFineTune)
+#endif
+                                        ))) {
+    f current_pitch_cv_value = f(pitch_cv * 12.0f);
 
     const float pitch_range = 72.0f;
-    float pitch_offset = (pitch_pot_base / 127.f) * pitch_range;
+    float pitch_offset = (sm[kSmoothPitch] / 127.f) * pitch_range;
     pitch_offset -= pitch_range / 2.0f;
 
-    dtc->params.pitch =
-        f(60.0f + pitch_offset) + current_pitch_cv_value + dtc->params.fine_tune;
+    dtc->params.pitch = f(60.0f + pitch_offset) + current_pitch_cv_value +
+                        dtc->params.fine_tune;
+  }
 
-    // root_panel_value is 0-210, divide by 10 to get 0.0-21.0
-    float root_offset = root_panel_value / 10.0f;
+  if (root_cv_changed || (moved & lane(kSmoothRoot))) {
+    f current_root_cv_value = f(root_cv * 12.0f);
+    // The root lane is 0-210, divide by 10 to get 0.0-21.0
+    float root_offset = sm[kSmoothRoot] / 10.0f;
 
     dtc->params.root = f(root_offset) + current_root_cv_value;
+  }
+  PROFILE_MARK(kStageMapping);
+}
+
+// Values of the "CV rate" parameter
+enum { kCvRateBlock, kCvRateLatest, kCvRateFiltered };
+
+// The control value of a CV bus for one engine block, held for the whole
+// block whatever the rate. Latest is the block's last sample, the most
+// recent value the bus has had, rather than the first. Filtered,
+// it is the mean over the block: fast CV is low-passed rather than aliased,
+// at the cost of passing through the values in between when it steps. A
+// block that holds still returns its value unchanged.
+static float readCv(const float *cv, int n, int rate) {
+  const float first = cv[0];
+  if (rate == kCvRateBlock)
+    return first;
+  if (rate == kCvRateLatest)
+    return cv[n - 1];
+  float sum = 0.0f;
+  bool varies = false;
+  for (int i = 0; i < n; ++i) {
+    sum += cv[i];
+    varies |= cv[i] != first;
+  }
+  return varies ? sum / float(n) : first;
+}
 
-    dtc->osc.Process(dtc->blk);
+// Runs the engine over one step() in blocks of N frames; returns the number
+// of blocks rendered
+template <int N>
+static int render(_ntEnosc_Alg *alg, _ntEnosc_Engine<N> &engine,
+                  float *busFrames, int numFrames) {
+  auto *dtc = alg->dtc;
 
+  // A local copy, so the block loop does not go back to SRAM for it
+  const Routing routing = alg->routing;
+  const float *pitchCv = busFrames + routing.pitch_cv_chan * numFrames;
+  const float *rootCv = busFrames + routing.root_cv_chan * numFrames;
+
+  float *outA = busFrames + routing.chanA * numFrames;
+  float *outB = busFrames + routing.chanB * numFrames;
+
+  constexpr int BS = N;
+
+  PROFILE_BEGIN();
+  int frame = 0;
+  int num_blocks = 0;
+  // What is left of the block the last call ended in comes first
+  if (dtc->carry_count > 0) {
+    const int n = std::min(dtc->carry_count, numFrames);
+    emit(dtc, routing, &engine.carry[BS - dtc->carry_count], outA, outB, n);
+    dtc->carry_count -= n;
+    frame = n;
+    PROFILE_MARK(kStageOutput);
+  }
+  for (; frame < numFrames; frame += BS) {
+    // A block that does not fit goes through the FIFO
     int valid = std::min(BS, numFrames - frame);
-    for (int i = 0; i < valid; ++i) {
-      float sampleL = Float(dtc->blk[i].l).repr() * 5.0f;
-      float sampleR = Float(dtc->blk[i].r).repr() * 5.0f;
-
-      if (replaceA) {
-        outA[frame + i] = sampleL;
-      } else {
-        outA[frame + i] += sampleL;
-      }
-      if (replaceB) {
-        outB[frame + i] = sampleR;
-      } else {
-        outB[frame + i] += sampleR;
-      }
+    const float pitch_cv = readCv(pitchCv + frame, valid, routing.cv_rate);
+    const float root_cv = readCv(rootCv + frame, valid, routing.cv_rate);
+    PROFILE_MARK(kStageCvRead);
+
+    // While the smoothers rest and the CVs hold still, the engine parameters
+    // from the last block are still right
+    const bool pitch_cv_changed = pitch_cv != dtc->last_pitch_cv;
+    const bool root_cv_changed = root_cv != dtc->last_root_cv;
+    if (dtc->controls_dirty || dtc->smooth.moving() || pitch_cv_changed ||
+        root_cv_changed) {
+      updateControls(alg, pitch_cv, root_cv, pitch_cv_changed,
+                     root_cv_changed, dtc->controls_dirty);
+      dtc->controls_dirty = false;
+      dtc->last_pitch_cv = pitch_cv;
+      dtc->last_root_cv = root_cv;
+    }
+
+    int num_osc = dtc->next_num_osc.load(std::memory_order_relaxed);
+    bool num_osc_changed = num_osc != dtc->params.alt.numOsc;
+    dtc->params.alt.numOsc = num_osc;
+    PROFILE_MARK(kStageMapping);
+
+    Buffer<Frame, BS> *target =
+        valid == BS ? renderTarget<BS>(routing, outA + frame, outB + frame)
+                    : nullptr;
+    Buffer<Frame, BS> &blk = target ? *target : engine.carry;
+    engine.osc.Process(blk);
+    dtc->rendered = true;
+    ++num_blocks;
+    PROFILE_MARK(kStageProcess);
+
+    if (num_osc_changed || dtc->discontinuity) {
+      dtc->discontinuity = false;
+      dtc->declick.trigger(Float(blk[0].l).repr() * 5.0f,
+                           Float(blk[0].r).repr() * 5.0f);
     }
+    // Read before the conversion below overwrites an in-place block
+    const Frame tail[2] = {blk[BS - 2], blk[BS - 1]};
+
+    emit(dtc, routing, &blk[0], outA + frame, outB + frame, valid);
+    dtc->carry_count = BS - valid;
+    dtc->declick.track(Float(tail[0].l).repr() * 5.0f,
+                       Float(tail[1].l).repr() * 5.0f,
+                       Float(tail[0].r).repr() * 5.0f,
+                       Float(tail[1].r).repr() * 5.0f);
+    PROFILE_MARK(kStageOutput);
+  }
+  PROFILE_END();
+  return num_blocks;
+}
+
+void step(_NT_algorithm *self, float *busFrames, int numFramesBy4) {
+  auto *alg = (_ntEnosc_Alg *)self;
+  auto *dtc = alg->dtc;
+
+  const int numFrames = numFramesBy4 * 4;
+
+  const uint32_t step_start = CycleCounter::now();
+  Tables::bind(alg->tables);
+  applyEvents(alg);
+  int num_blocks = 0;
+  withEngine(alg, [&](auto &engine) {
+    num_blocks = render(alg, engine, busFrames, numFrames);
+  });
+  Tables::unbind();
+
+  const uint32_t step_cycles = CycleCounter::now() - step_start;
+  const uint32_t per_block = step_cycles / uint32_t(std::max(num_blocks, 1));
+  if (alg->peak_frames >= NT_globals.sampleRate) {
+    alg->peak_per_block = 0;
+    alg->peak_frames = 0;
+  }
+  alg->peak_frames += numFrames;
+  alg->peak_per_block = std::max(alg->peak_per_block, per_block);
+
+  const uint32_t budget_per_sample =
+      CycleCounter::kTicksPerSecond / NT_globals.sampleRate;
+  LoadSnapshot snap;
+  snap.cycles_per_block = per_block;
+  snap.peak_per_block = alg->peak_per_block;
+  snap.load_permille = uint16_t(std::min<uint32_t>(
+      uint32_t(uint64_t(step_cycles) * 1000 /
+               (uint64_t(budget_per_sample) * uint32_t(numFrames))),
+      9999));
+  snap.num_osc = uint8_t(dtc->params.alt.numOsc);
+
+  const int budget = alg->cpu_budget;
+  const int max_osc = alg->max_osc;
+  if (budget > 0) {
+    dtc->next_num_osc.store(alg->governor.update(
+        dtc->params.alt.numOsc, max_osc, snap.load_permille,
+        uint32_t(budget) * 10, uint32_t(numFrames), NT_globals.sampleRate));
+  } else if (dtc->params.alt.numOsc != max_osc) {
+    dtc->next_num_osc.store(max_osc);
+  }
+  snap.twist_mode = uint8_t(dtc->params.twist.mode);
+  snap.warp_mode = uint8_t(dtc->params.warp.mode);
+  alg->load.publish(snap);
+}
+
+// Appends the decimal representation of x, returns the new end
+static char *appendUint(char *out, uint32_t x) {
+  char digits[10];
+  int n = 0;
+  do {
+    digits[n++] = char('0' + x % 10);
+    x /= 10;
+  } while (x);
+  while (n)
+    *out++ = digits[--n];
+  *out = 0;
+  return out;
+}
+
+static char *appendStr(char *out, const char *str) {
+  while (*str)
+    *out++ = *str++;
+  *out = 0;
+  return out;
+}
+
+bool draw(_NT_algorithm *self) {
+  auto *alg = (_ntEnosc_Alg *)self;
+  if (!self->v[kParamLoadDisplay])
+    return false;
+
+  // Only reads the snapshot; never touches the engine state
+  LoadSnapshot snap = alg->load.read();
+  char line[48];
+
+  char *p = appendUint(line, snap.cycles_per_block);
+  p = appendStr(p, " cyc/blk  peak ");
+  appendUint(p, snap.peak_per_block);
+  NT_drawText(255, 50, line, 15, kNT_textRight, kNT_textTiny);
+
+  p = appendUint(line, snap.num_osc);
+  p = appendStr(p, " osc  ");
+  p = appendStr(p, enumTwist[snap.twist_mode % 3]);
+  p = appendStr(p, "/");
+  p = appendStr(p, enumWarp[snap.warp_mode % 3]);
+  p = appendStr(p, "  ");
+  p = appendUint(p, snap.load_permille / 10);
+  p = appendStr(p, ".");
+  p = appendUint(p, snap.load_permille % 10);
+  appendStr(p, "%");
+  NT_drawText(255, 60, line, 15, kNT_textRight, kNT_textTiny);
+  return false;
+}
+
+#ifdef NT_HOST
+// Prints where the instance's bytes go, per memory region; used by the host
+// renderer's -m option.
+extern "C" void ntEnoscPrintLayout(const _NT_algorithmRequirements &req) {
+  const unsigned common = kEngineOffset;
+  const unsigned engine_params = sizeof(Parameters);
+  printf("dtc  %6u bytes (hot)\n", req.dtc);
+  printf("  engine, FIFO     %6u\n", req.dtc - common);
+  printf("  engine params    %6u\n", engine_params);
+  printf("  smoothers, etc.  %6u\n", common - engine_params);
+  printf("sram %6u bytes (cold)\n", req.sram);
+  printf("itc  %6u bytes (lookup tables)\n", req.itc);
+  printf("dram %6u bytes\n", req.dram);
+  printf("static dram %6u bytes (shared lookup tables)\n",
+         Tables::sharedBytes());
+}
+#endif
+
+#if defined(NT_PROFILE) && defined(NT_HOST)
+// Prints the stage statistics of the last 32 step() calls; used by the host
+// tools when built with PROFILE=1.
+extern "C" void ntEnoscPrintProfile(_NT_algorithm *self) {
+  const Profiler &prof = ((_ntEnosc_Alg *)self)->profiler;
+  printf("stage      min ns   mean ns    max ns  (last %d step calls)\n",
+         prof.count());
+  for (int s = 0; s < kNumStages; ++s) {
+    Profiler::Stats st = prof.stats(s);
+    printf("%-8s %8u  %8u  %8u\n", stageNames[s], st.min, st.mean, st.max);
   }
 }
+#endif
 
 // Current internal version for preset format
 static constexpr int kInternalVersion = 2;
@@ -441,13 +1079,15 @@ static const _NT_factory factory = {
     .guid = NT_MULTICHAR('T', 'h', 'E', 'O'),
     .name = "EnsembleOsc",
     .description = "4ms Ensemble Oscillator port",
+    .numSpecifications = kNumSpecifications,
+    .specifications = specifications,
     .calculateStaticRequirements = calculateStaticRequirements,
     .initialise = initialise,
     .calculateRequirements = calculateRequirements,
     .construct = construct,
     .parameterChanged = parameterChanged,
     .step = step,
-    .draw = nullptr,
+    .draw = draw,
     .midiRealtime = nullptr,
     .midiMessage = nullptr,
     .tags = 0,
@@ -0,0 +1,116 @@
+#pragma once
+
+// Cycle counting for the step() stages.
+//
+// On the NT this reads the Cortex-M7 DWT cycle counter. The host build has no
+// such thing and falls back to a monotonic clock, so "cycles" there are
+// nanoseconds.
+
+#include <atomic>
+#include <stdint.h>
+#ifdef NT_HOST
+#include <chrono>
+#endif
+
+namespace CycleCounter {
+
+#ifdef NT_HOST
+static constexpr uint32_t kTicksPerSecond = 1000000000u;
+
+inline uint32_t now() {
+  return uint32_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now().time_since_epoch())
+                      .count());
+}
+
+inline void enable() {}
+#else
+// Core clock of the NT's Cortex-M7
+static constexpr uint32_t kTicksPerSecond = 600000000u;
+
+inline uint32_t now() { return *(volatile uint32_t *)0xE0001004; } // DWT_CYCCNT
+
+// The firmware normally has the counter running already; make sure of it.
+inline void enable() {
+  *(volatile uint32_t *)0xE000EDFC |= 1u << 24;     // DEMCR.TRCENA
+  *(volatile uint32_t *)0xE0001FB0 = 0xC5ACCE55u;   // DWT_LAR unlock
+  *(volatile uint32_t *)0xE0001000 |= 1u;           // DWT_CTRL.CYCCNTENA
+}
+#endif
+
+} // namespace CycleCounter
+
+// Accumulates the cycles spent in each stage over one step() call and keeps
+// the totals of the last kHistory calls in a ring, from which min/mean/max
+// are derived on demand. Stages are closed by mark(), which charges the time
+// since the previous mark (or begin()) to the given stage.
+template <int kNumStages, int kHistory> class StageProfiler {
+public:
+  struct Stats {
+    uint32_t min, mean, max;
+  };
+
+  void begin() {
+    for (int s = 0; s < kNumStages; ++s)
+      current_[s] = 0;
+    last_ = CycleCounter::now();
+  }
+
+  void mark(int stage) {
+    uint32_t t = CycleCounter::now();
+    current_[stage] += t - last_;
+    last_ = t;
+  }
+
+  void end() {
+    for (int s = 0; s < kNumStages; ++s)
+      ring_[head_][s] = current_[s];
+    head_ = (head_ + 1) % kHistory;
+    if (count_ < kHistory)
+      ++count_;
+  }
+
+  int count() const { return count_; }
+
+  Stats stats(int stage) const {
+    Stats st = {0, 0, 0};
+    if (count_ == 0)
+      return st;
+    uint64_t sum = 0;
+    st.min = UINT32_MAX;
+    for (int i = 0; i < count_; ++i) {
+      uint32_t c = ring_[i][stage];
+      sum += c;
+      st.min = c < st.min ? c : st.min;
+      st.max = c > st.max ? c : st.max;
+    }
+    st.mean = uint32_t(sum / uint32_t(count_));
+    return st;
+  }
+
+private:
+  uint32_t current_[kNumStages] = {};
+  uint32_t ring_[kHistory][kNumStages] = {};
+  uint32_t last_ = 0;
+  int head_ = 0;
+  int count_ = 0;
+};
+
+// Single-writer double buffer: the audio thread publish()es into the slot the
+// reader is not pointed at and then flips the index, so neither side ever
+// waits. A reader that is preempted across two publishes can see a mix of
+// two snapshots, which is harmless for display purposes.
+template <typename T> class SnapshotBuffer {
+public:
+  void publish(const T &value) {
+    int next = index_.load(std::memory_order_relaxed) ^ 1;
+    slots_[next] = value;
+    index_.store(next, std::memory_order_release);
+  }
+
+  T read() const { return slots_[index_.load(std::memory_order_acquire)]; }
+
+private:
+  T slots_[2] = {};
+  std::atomic<int> index_{0};
+};
@@ -0,0 +1,106 @@
+#pragma once
+
+// Smoothing for a fixed set of controls.
+//
+// By default each lane approaches its target exponentially (one-pole). In
+// linear mode it instead ramps at a constant rate, fixed when the target is
+// set, that arrives in exactly the smoothing time; there is no long tail, so
+// a control lands where it was set that much sooner.
+//
+// The lanes are kept as parallel arrays, padded to a multiple of four, so
+// that advance() moves all of them in one pass the compiler can vectorize.
+// The linear ramps' increments are only read in linear mode and live outside
+// the bank, in kPadded floats its owner provides through set_step_storage(),
+// so that they need not take up the bank's fast memory.
+// A lane whose value has come within kEpsilon of its target, or has stopped
+// changing, snaps to it and drops out of the moving() mask; advancing such a
+// lane changes nothing, so it is not excluded from the pass.
+
+#include <math.h>
+#include <stdint.h>
+
+template <int kLanes> class SmootherBank {
+  static_assert(kLanes <= 32, "the moving mask has one bit per lane");
+
+public:
+  static constexpr int kPadded = (kLanes + 3) & ~3;
+
+  // Coefficient for an exponential approach with the given time constant
+  // when advance() is called once every `frames` samples
+  static float alpha_for(float seconds, int frames, float sample_rate) {
+    return 1.0f - expf(-float(frames) / (seconds * sample_rate));
+  }
+
+  // Fraction of the distance to a new target covered per advance() in
+  // linear mode, for the given ramp time
+  static float rate_for(float seconds, int frames, float sample_rate) {
+    return float(frames) / (seconds * sample_rate);
+  }
+
+  void set_alpha(float alpha) { alpha_ = alpha; }
+  void set_rate(float rate) { rate_ = rate; }
+  void set_linear(bool linear) { linear_ = linear; }
+  void set_step_storage(float *steps) { step_ = steps; }
+
+  void set_target(int lane, float target) {
+    target_[lane] = target;
+    step_[lane] = fabsf(target - current_[lane]) * rate_;
+    if (target != current_[lane])
+      moving_ |= 1u << lane;
+  }
+
+  // Set target without interpolation
+  void set_hard(int lane, float value) {
+    target_[lane] = value;
+    current_[lane] = value;
+    moving_ &= ~(1u << lane);
+  }
+
+  // Moves every lane one step towards its target; returns the lanes that
+  // moved
+  uint32_t advance() {
+    const uint32_t moved = moving_;
+    if (!moved)
+      return 0;
+    if (linear_) {
+      for (int i = 0; i < kPadded; ++i) {
+        float d = fminf(fmaxf(target_[i] - current_[i], -step_[i]), step_[i]);
+        current_[i] = settle(current_[i], current_[i] + d, target_[i]);
+      }
+    } else {
+      for (int i = 0; i < kPadded; ++i) {
+        current_[i] = settle(
+            current_[i], current_[i] + alpha_ * (target_[i] - current_[i]),
+            target_[i]);
+      }
+    }
+    uint32_t still = 0;
+    for (int i = 0; i < kLanes; ++i)
+      still |= uint32_t(current_[i] != target_[i]) << i;
+    moving_ = still;
+    return moved;
+  }
+
+  float operator[](int lane) const { return current_[lane]; }
+  uint32_t moving() const { return moving_; }
+
+private:
+  // In raw parameter units; a thousandth of a step is far below audibility
+  static constexpr float kEpsilon = 1e-3f;
+
+  // Near the target the one-pole's step can round away to nothing (a glide
+  // to 127 with the default smoothing stops about 8e-3 short), and the lane
+  // would never settle; such a lane snaps too
+  static float settle(float current, float next, float target) {
+    return fabsf(target - next) < kEpsilon || next == current ? target : next;
+  }
+
+  float current_[kPadded] = {};
+  float target_[kPadded] = {};
+  // Per-advance() increment of each lane's linear ramp
+  float *step_ = nullptr;
+  float alpha_ = 0.0f;
+  float rate_ = 0.0f;
+  bool linear_ = false;
+  uint32_t moving_ = 0;
+};
@@ -0,0 +1,125 @@
+// Built with -ffp-contract=off (see the Makefile): gen.py never fuses a
+// multiply and an add, and neither may we.
+
+#include "table_synth.hh"
+
+#if defined(SYNTHESIZE_TABLES) || defined(NT_HOST)
+
+#include <math.h>
+
+namespace TableSynth {
+
+// What gen.py's '{x:.8f}' turns x into once the compiler reads the literal
+// back: the nearest representable value to x rounded to 8 decimals.
+// gen.py prints negative numbers as '-' applied to a positive literal, so
+// the magnitude is returned and the sign applied by the caller.
+static long double printed(double x) {
+  return (long double)nearbyint(fabs(x) * 1e8) / 1e8L;
+}
+
+static s1_15 literal_s1_15(double x) {
+  s1_15 v = operator""_s1_15(printed(x));
+  return signbit(x) ? -v : v;
+}
+
+static f literal_f(double x) {
+  f v = operator""_f(printed(x));
+  return signbit(x) ? -v : v;
+}
+
+// gen_sine(): MagicSine quantized to s1_15, as (value, delta) pairs
+void sine(DynamicData::Sine &table) {
+  const double omega = 2.0 * M_PI * (1.0 / (sine_size - 1));
+  const double scale = (1 << 15) - 1;
+  double sinz = 0.0, cosz = 1.0;
+  auto process = [&]() {
+    sinz += omega * cosz;
+    cosz -= omega * sinz;
+    return sinz;
+  };
+  double prev = process();
+  for (int i = 0; i < sine_size; ++i) {
+    int qv = int(prev * scale);
+    double curr = process();
+    int qc = int(curr * scale);
+    table[i] = {literal_s1_15(qv / scale), literal_s1_15((qc - qv) / scale)};
+    prev = curr;
+  }
+}
+
+// gen_cheby(): Chebyshev polynomials by recurrence, in float32 like numpy
+void cheby(DynamicData::Cheby &table) {
+  float t[3][cheby_size];
+  float *x = t[0];
+  for (int i = 0; i < cheby_size; ++i)
+    x[i] = float(-1.0 + 2.0 * i / (cheby_size - 1));
+  for (int i = 0; i < cheby_size; ++i)
+    table[0][i] = literal_f(x[i]);
+
+  float *prev2 = t[1], *prev = t[2];
+  for (int i = 0; i < cheby_size; ++i) {
+    prev[i] = 2.0f * (x[i] * x[i]) - 1.0f;
+    table[1][i] = literal_f(prev[i]);
+  }
+  // cheby[n-2] starts out as cheby[0]
+  for (int i = 0; i < cheby_size; ++i)
+    prev2[i] = x[i];
+
+  for (int n = 2; n < cheby_tables; ++n) {
+    for (int i = 0; i < cheby_size; ++i) {
+      float next = 2.0f * x[i] * prev[i] - prev2[i];
+      prev2[i] = prev[i];
+      prev[i] = next;
+      table[n][i] = literal_f(next);
+    }
+  }
+}
+
+// gen_fold() and gen_fold_max()
+void fold(DynamicData::Fold &table, DynamicData::FoldMax &fold_max) {
+  const double folds = 6.0;
+  double values[fold_size];
+  double prev = 0.0;
+  for (int i = 0; i < fold_size; ++i) {
+    double x = double(i) / (fold_size - 3);
+    x = folds * (2.0 * x - 1.0);
+    double g = 1.0 / (1.0 + fabs(x));
+    double p = 16.0 / (2.0 * M_PI) * x * g;
+    while (p > 1.0)
+      p -= 1.0;
+    while (p < 0.0)
+      p += 1.0;
+    double xx = -g * (x + sin(p * M_PI * 2.0));
+    if (i) {
+      values[i] = prev;
+      table[i] = {literal_f(prev), literal_f(xx - prev)};
+    } else {
+      values[i] = xx;
+      table[i] = {literal_f(xx), literal_f(0.0)};
+    }
+    prev = xx;
+  }
+
+  const int start = (fold_size - 1) / 2;
+  double maxval = 0.0;
+  for (int i = 0; i < (fold_size - 1) / 2 + 1; ++i) {
+    maxval = fmax(maxval, fabs(values[i + start]));
+    fold_max[i] = literal_f(0.92 / (maxval + 0.00001));
+  }
+}
+
+// gen_exp2_table(): 2^(i/1024) in 9.23 fixed point
+void exp2(uint32_t (&table)[1024]) {
+  // 2.0 ** (1.0 / 1024) as Python computes it, spelled out so that the
+  // result does not depend on the target's pow()
+  const double increment = 0x1.002c605e2e8cfp+0;
+  double x = 1.0;
+  for (int i = 0; i < 1024; ++i) {
+    table[i] = uint32_t(x * (1 << 23));
+    x *= increment;
+  }
+}
+
+} // namespace TableSynth
+
+#endif
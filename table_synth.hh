@@ -0,0 +1,18 @@
+#pragma once
+
+// Computes the lookup tables that gen.py otherwise prints into
+// dynamic_data.cc and math.cc, bit for bit: every value goes through the
+// same '%.8f' rounding and the same user-defined literal operators as the
+// generated source does.
+
+#include "dynamic_data.hh"
+#include <stdint.h>
+
+namespace TableSynth {
+
+void sine(DynamicData::Sine &table);
+void cheby(DynamicData::Cheby &table);
+void fold(DynamicData::Fold &table, DynamicData::FoldMax &fold_max);
+void exp2(uint32_t (&table)[1024]);
+
+} // namespace TableSynth
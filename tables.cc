@@ -0,0 +1,107 @@
+#include "tables.hh"
+
+#include <cstring>
+#include <new>
+#ifdef SYNTHESIZE_TABLES
+#include "./enosc/lib/easiglib/math.hh"
+#include "table_synth.hh"
+#endif
+
+#ifdef SYNTHESIZE_TABLES
+// Nothing to point at before initialise() has computed the tables
+TableRef<DynamicData::Sine> DynamicData::sine{nullptr};
+TableRef<DynamicData::Cheby> DynamicData::cheby{nullptr};
+TableRef<DynamicData::Fold> DynamicData::fold{nullptr};
+TableRef<DynamicData::FoldMax> DynamicData::fold_max{nullptr};
+#elif defined(FAST_TABLES)
+TableRef<DynamicData::Sine> DynamicData::sine{&DynamicData::sine_data};
+TableRef<DynamicData::Cheby> DynamicData::cheby{&DynamicData::cheby_data};
+TableRef<DynamicData::Fold> DynamicData::fold{&DynamicData::fold_data};
+TableRef<DynamicData::FoldMax> DynamicData::fold_max{
+    &DynamicData::fold_max_data};
+#endif
+
+namespace Tables {
+
+static constexpr uint32_t align(uint32_t bytes) { return (bytes + 31) & ~31u; }
+
+static constexpr uint32_t kSineBytes = align(sizeof(DynamicData::Sine));
+static constexpr uint32_t kChebyBytes = align(sizeof(DynamicData::Cheby));
+static constexpr uint32_t kFoldBytes = align(sizeof(DynamicData::Fold));
+static constexpr uint32_t kFoldMaxBytes = align(sizeof(DynamicData::FoldMax));
+
+#ifdef SYNTHESIZE_TABLES
+static TableSet shared_set;
+#elif defined(FAST_TABLES)
+static const TableSet shared_set = {
+    &DynamicData::sine_data, &DynamicData::cheby_data, &DynamicData::fold_data,
+    &DynamicData::fold_max_data};
+#endif
+
+#ifdef REBIND_TABLES
+static void point(const TableSet &set) {
+  DynamicData::sine.bind(set.sine);
+  DynamicData::cheby.bind(set.cheby);
+  DynamicData::fold.bind(set.fold);
+  DynamicData::fold_max.bind(set.fold_max);
+}
+#endif
+
+#ifdef SYNTHESIZE_TABLES
+uint32_t sharedBytes() {
+  return kSineBytes + kChebyBytes + kFoldBytes + kFoldMaxBytes;
+}
+
+template <typename T> static T *place(uint8_t *&mem) {
+  T *p = new (mem) T;
+  mem += align(sizeof(T));
+  return p;
+}
+
+void initialise(uint8_t *dram) {
+  DynamicData::Sine *sine = place<DynamicData::Sine>(dram);
+  DynamicData::Cheby *cheby = place<DynamicData::Cheby>(dram);
+  DynamicData::Fold *fold = place<DynamicData::Fold>(dram);
+  DynamicData::FoldMax *fold_max = place<DynamicData::FoldMax>(dram);
+  TableSynth::sine(*sine);
+  TableSynth::cheby(*cheby);
+  TableSynth::fold(*fold, *fold_max);
+  TableSynth::exp2(Math::exp2_table);
+  shared_set = {sine, cheby, fold, fold_max};
+  point(shared_set);
+}
+#else
+// The generated tables in the plugin image are the shared ones
+uint32_t sharedBytes() { return 0; }
+
+void initialise(uint8_t *) {}
+#endif
+
+#ifdef FAST_TABLES
+template <typename T> static const T *copy(uint8_t *&mem, const T &table) {
+  std::memcpy(mem, &table, sizeof(T));
+  const T *p = (const T *)mem;
+  mem += align(sizeof(T));
+  return p;
+}
+
+uint32_t instanceBytes() { return kSineBytes + kFoldBytes + kFoldMaxBytes; }
+
+TableSet instance(uint8_t *itc) {
+  // Cheby (16 tables, ~32 KB) is too large to duplicate per instance. Only
+  // the two rows around the current Warp are read at a time, but the
+  // engine picks and blends them itself, per sample, so a smaller cache of
+  // just those rows (or of their blend) would need a change to the engine.
+  TableSet set = shared_set;
+  set.sine = copy(itc, *shared_set.sine);
+  set.fold = copy(itc, *shared_set.fold);
+  set.fold_max = copy(itc, *shared_set.fold_max);
+  return set;
+}
+
+void bind(const TableSet &set) { point(set); }
+
+void unbind() { point(shared_set); }
+#endif
+
+} // namespace Tables
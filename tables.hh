@@ -0,0 +1,53 @@
+#pragma once
+
+// Placement of the DynamicData lookup tables, chosen at build time.
+//
+// By default the engine reads the generated tables in the plugin image at
+// their fixed addresses, and nothing here has any work to do.
+//
+// Built with SYNTHESIZE_TABLES the plugin image carries no tables at all:
+// initialise() computes them (and Math::exp2_table) with TableSynth into
+// static DRAM, shared by all instances, and the engine reads them there
+// through TableRefs.
+//
+// Built with FAST_TABLES each instance copies the tables read on every
+// sample (sine, fold and fold_max) into its own ITC. step() binds its
+// instance's set around the engine and restores the shared tables
+// afterwards, so the tables never point into memory of an instance that has
+// been removed.
+
+#include "dynamic_data.hh"
+#include <stdint.h>
+
+struct TableSet {
+  const DynamicData::Sine *sine;
+  const DynamicData::Cheby *cheby;
+  const DynamicData::Fold *fold;
+  const DynamicData::FoldMax *fold_max;
+};
+
+namespace Tables {
+
+// Static DRAM taken by the synthesized tables; 0 unless SYNTHESIZE_TABLES
+uint32_t sharedBytes();
+// Computes the synthesized tables into dram; called from initialise()
+void initialise(uint8_t *dram);
+
+#ifdef FAST_TABLES
+// Per-instance ITC needed for the copies
+uint32_t instanceBytes();
+// Copies the tables read per sample into itc
+TableSet instance(uint8_t *itc);
+// Points the DynamicData tables at an instance's set
+void bind(const TableSet &set);
+// Points them back at the shared tables
+void unbind();
+#else
+// Every instance reads the shared tables; there is nothing to copy or bind
+inline uint32_t instanceBytes() { return 0; }
+inline TableSet instance(uint8_t *) { return {}; }
+inline void bind(const TableSet &) {}
+inline void unbind() {}
+#endif
+
+} // namespace Tables